@@ -1,25 +1,34 @@
-
 #include "abcoefs.h"
 
-// Compute the coefficients for the Adams-Bashforth scheme
+// Compute the coefficients for the Adams-Bashforth scheme. Each CRM has its
+// own, because CRMs subcycled with their own cycle count have their own
+// history of time steps in dt3.
 void abcoefs() {
   if (nstep >= 3) {
-    realHost1d dt3Host("dt3Host",3);
+    realHost2d dt3Host("dt3Host",3,ncrms);
+    realHost1d atHost ("atHost" ,ncrms);
+    realHost1d btHost ("btHost" ,ncrms);
+    realHost1d ctHost ("ctHost" ,ncrms);
     dt3.deep_copy_to(dt3Host);
     yakl::fence();
-    real alpha = dt3Host(nb-1) / dt3Host(na-1);
-    real beta  = dt3Host(nc-1) / dt3Host(na-1);
-    ct = (2.+3.* alpha) / (6.* (alpha + beta) * beta);
-    bt = -(1.+2.*(alpha + beta) * ct)/(2. * alpha);
-    at = 1. - bt - ct;
+    for (int icrm=0; icrm<ncrms; icrm++) {
+      real alpha = dt3Host(nb-1,icrm) / dt3Host(na-1,icrm);
+      real beta  = dt3Host(nc-1,icrm) / dt3Host(na-1,icrm);
+      ctHost(icrm) = (2.+3.* alpha) / (6.* (alpha + beta) * beta);
+      btHost(icrm) = -(1.+2.*(alpha + beta) * ctHost(icrm))/(2. * alpha);
+      atHost(icrm) = 1. - btHost(icrm) - ctHost(icrm);
+    }
+    atHost.deep_copy_to(at);
+    btHost.deep_copy_to(bt);
+    ctHost.deep_copy_to(ct);
   } else if (nstep >= 2) {
-    at = 3./2.;
-    bt = -1./2.;
-    ct = 0.;
+    yakl::memset(at, 3./2.);
+    yakl::memset(bt,-1./2.);
+    yakl::memset(ct, 0.);
   } else {
-    at = 1.;
-    bt = 0.;
-    ct = 0.;
+    yakl::memset(at, 1.);
+    yakl::memset(bt, 0.);
+    yakl::memset(ct, 0.);
   }
 }
 
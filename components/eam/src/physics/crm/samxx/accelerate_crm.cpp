@@ -1,7 +1,7 @@
 
 #include "accelerate_crm.h"
 
-void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
+void accelerate_crm(int nstep, int nstop, bool1d &ceaseflag) {
   YAKL_SCOPE( t                  , ::t);
   YAKL_SCOPE( qcl                , ::qcl);
   YAKL_SCOPE( qci                , ::qci);
@@ -32,6 +32,19 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   real2d vtend_acc("vtend_acc", nzm, ncrms);
   real2d qpoz("qpoz", nzm, ncrms);
   real2d qneg("qneg", nzm, ncrms);
+  bool1d cease_now("cease_now", ncrms);
+
+  // Nothing to do once acceleration has ceased for every CRM
+  ScalarLiveOut<bool> active_liveout(false);
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    cease_now(icrm) = false;
+    if (! ceaseflag(icrm)) {
+      active_liveout = true;
+    }
+  });
+  if (! active_liveout.hostRead()) {
+    return;
+  }
 
   // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   // Compute the average among horizontal columns for each variable
@@ -77,18 +90,19 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
       utend_acc(k,icrm) = ubaccel(k,icrm) - u0(k,icrm);
       vtend_acc(k,icrm) = vbaccel(k,icrm) - v0(k,icrm);
     }
-    if (abs(ttend_acc(k,icrm)) > ttend_threshold) {
+    if (! ceaseflag(icrm) && abs(ttend_acc(k,icrm)) > ttend_threshold) {
+      cease_now(icrm) = true;
       ceaseflag_liveout = true;
     }
   });
-  ceaseflag = ceaseflag_liveout.hostRead();
+  bool cease_any = ceaseflag_liveout.hostRead();
 
 
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   //!! Make sure it isn't insane
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-  if (ceaseflag) { // special case for dT/dt too large
+  if (cease_any) { // special case for dT/dt too large
     // MSA will not be applied here or for the remainder of the CRM integration.
     // nstop must be updated to ensure the CRM integration duration is unchanged.
     // 
@@ -106,7 +120,19 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
     std::cout << "accelerate_crm: mean-state acceleration not applied this step";
     std::cout << "crm: nstop increased from " << nstop << " to " << round(nstop+(nstop-nstep+1)*crm_accel_factor);
     nstop = nstop + (nstop - nstep + 1)*crm_accel_factor; // only can happen once
-    return;
+
+    // Each CRM subcycled with its own cycle count stops on its own, so the
+    // result does not depend on the order in which subcycle_crms() advances
+    // them. Otherwise every CRM stops, as in the Fortran SAM.
+    bool cease_all = ! use_crm_subcycle;
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      if (cease_all || cease_now(icrm)) {
+        ceaseflag(icrm) = true;
+      }
+    });
+    if (cease_all) {
+      return;
+    }
   }
 
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -118,6 +144,7 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (ceaseflag(icrm)) { return; }
     // don't let T go negative!
     t(k,j+offy_s,i+offx_s,icrm) = max(tmin, t(k,j+offy_s,i+offx_s,icrm) + crm_accel_factor * ttend_acc(k,icrm));
     if (crm_accel_uv) {
@@ -145,6 +172,7 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (ceaseflag(icrm)) { return; }
     if (micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) < 0.0) {
       yakl::atomicAdd( qneg(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) ); 
     }
@@ -158,6 +186,7 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    if (ceaseflag(icrm)) { return; }
     real factor;
     if (qpoz(k,icrm) + qneg(k,icrm) <= 0.0) {
       // all moisture depleted in layer
@@ -4,7 +4,7 @@
 #include "samxx_const.h"
 #include "vars.h"
 
-void accelerate_crm(int nstep, int nstop, bool &ceaseflag);
+void accelerate_crm(int nstep, int nstop, bool1d &ceaseflag);
 
 void crm_accel_nstop(int &nstop);
 
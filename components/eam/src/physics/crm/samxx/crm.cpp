@@ -48,7 +48,7 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
                     real *crm_clear_rh_p,
                     real *lat0_p, real *long0_p, int *gcolp_p, int igstep_in,
                     bool use_VT_in, int VT_wn_max_in, bool use_ESMT_in,
-                    bool use_crm_accel_in, real crm_accel_factor_in, bool crm_accel_uv_in) {
+                    bool use_crm_accel_in, real crm_accel_factor_in, bool crm_accel_uv_in, bool use_crm_subcycle_in) {
 
   dt_glob = dt_gl;
   pcols = pcols_in;
@@ -60,6 +60,7 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
   use_crm_accel = use_crm_accel_in;
   crm_accel_factor = crm_accel_factor_in;
   crm_accel_uv = crm_accel_uv_in;
+  use_crm_subcycle = use_crm_subcycle_in;
 
   create_and_copy_inputs(crm_input_bflxls_p, crm_input_wndls_p, crm_input_zmid_p, crm_input_zint_p, 
                          crm_input_pmid_p, crm_input_pint_p, crm_input_pdel_p, crm_input_ul_p, crm_input_vl_p, 
@@ -21,8 +21,8 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
     fft_out(k,j,i,icrm) = f_in(k,j,i,icrm);
   });
 
-  vt_fftx.forward_real(fft_out, 2, nx);
-  if (RUN3D) { vt_ffty.forward_real(fft_out, 1, ny); }
+  crm_fft_plans().vt_fftx.forward_real(fft_out, 2, nx);
+  if (RUN3D) { crm_fft_plans().vt_ffty.forward_real(fft_out, 1, ny); }
 
   //----------------------------------------------------------------------------
   // Zero out the higher modes
@@ -50,8 +50,8 @@ void VT_filter(int filter_wn_max, real4d &f_in, real4d &f_out) {
   //----------------------------------------------------------------------------
   // Backward Fourier transform
 
-  if (RUN3D) { vt_ffty.inverse_real(fft_out); }
-  vt_fftx.inverse_real(fft_out);
+  if (RUN3D) { crm_fft_plans().vt_ffty.inverse_real(fft_out); }
+  crm_fft_plans().vt_fftx.inverse_real(fft_out);
 
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     f_out(k,j,i,icrm) = fft_out(k,j,i,icrm);
@@ -13,12 +13,15 @@ void kurant () {
   YAKL_SCOPE( adzw  , ::adzw );
   YAKL_SCOPE( ncrms , ::ncrms );
 
+  YAKL_SCOPE( ncycle_crm , ::ncycle_crm );
+  YAKL_SCOPE( ncycle     , ::ncycle );
+
   int constexpr max_ncycle = 4;
   real cfl;
 
-  real2d wm    ("wm"   ,nz ,ncrms);
-  real2d uhm   ("uhm"  ,nz ,ncrms);
-  real2d tmpMax("uhMax",nzm,ncrms);
+  real2d wm     ("wm"     ,nz ,ncrms);
+  real2d uhm    ("uhm"    ,nz ,ncrms);
+  real1d cfl_crm("cfl_crm",ncrms);
 
   ncycle = 1;
   parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -26,6 +29,10 @@ void kurant () {
     uhm(k,icrm) = 0.0;
   });
 
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    cfl_crm(icrm) = 0.0;
+  });
+
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny; j++) {
   //     for (int i=0; i<nx; i++) {
@@ -50,11 +57,13 @@ void kurant () {
     real dztemp = dz(icrm)*adzw(k,icrm);
     real tmp2 = wm(k,icrm)*dt/dztemp;
     real tmp3 = wm(k+1,icrm)*dt/dztemp;
-    tmpMax(k,icrm) = max(max(tmp1,tmp2),tmp3);
+    yakl::atomicMax(cfl_crm(icrm),max(max(tmp1,tmp2),tmp3));
   });
 
-  yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
-  real cfl_loc = pmax(tmpMax.data());
+  kurant_sgs(cfl_crm);
+
+  yakl::ParallelMax<real,yakl::memDevice> pmax( ncrms );
+  real cfl_loc = pmax(cfl_crm.data());
   cfl = max(cfl,cfl_loc);
 
 
@@ -64,18 +73,30 @@ void kurant () {
     exit(-1);
   }
 
-  kurant_sgs(cfl);
-
   ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
 
 #ifdef MMF_FIXED_SUBCYCLE
   ncycle = max_ncycle;
 #endif
 
+  // Number of subcycles each CRM takes in this time step. With
+  // use_crm_subcycle, subcycle_crms() advances the CRMs that need fewer
+  // subcycles than the global ncycle separately. Otherwise every CRM takes
+  // ncycle subcycles, as in the Fortran SAM.
+  bool per_crm = use_crm_subcycle;
+#ifdef MMF_FIXED_SUBCYCLE
+  per_crm = false;
+#endif
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    if (per_crm) {
+      ncycle_crm(icrm) = max(1,static_cast<int>(ceil(cfl_crm(icrm)/0.7)));
+    } else {
+      ncycle_crm(icrm) = ncycle;
+    }
+  });
+
   if(ncycle > max_ncycle) {
     std::cout << "\nkurant() - the number of cycles exceeded max_ncycle = "<< max_ncycle << std::endl;
     exit(-1);
   }
 }
-
-
@@ -157,7 +157,7 @@ void pre_timeloop() {
   YAKL_SCOPE( use_VT                  , :: use_VT );
   YAKL_SCOPE( use_ESMT                , :: use_ESMT );
 
-  crm_accel_ceaseflag = false;
+  yakl::memset(crm_accel_ceaseflag,false);
 
   //Loop over "vector columns"
   // for (int icrm=0; icrm<ncrms; icrm++) {
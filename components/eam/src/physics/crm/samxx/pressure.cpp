@@ -20,10 +20,10 @@ void pressure() {
   int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
+  // The vertical solve works in place on f, which requires all levels in one slab
+  static_assert(nsubdomains == 1, "pressure() requires nzslab == nzm");
+
   real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
 
   int iwall = 0;
   int nypp, jwall;
@@ -35,8 +35,6 @@ void pressure() {
     nypp = ny+2;
   }
 
-  real2d eign("eign",nypp,nx+1);
-
   press_rhs();
 
   // for (int k=0; k<nzslab; k++) {
@@ -49,24 +47,29 @@ void pressure() {
 
   #ifndef USE_ORIG_FFT
 
-    pressure_fftx.forward_real(f, 2, nx);
-    if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+    crm_fft_plans().pressure_fftx.forward_real(f, 2, nx);
+    if (RUN3D) { crm_fft_plans().pressure_ffty.forward_real(f, 1, ny); }
 
   #else
 
     realHost2d work  ("work"  ,ny2,nx2);
     realHost1d ftmp_x("ftmp_x",nx2);
     realHost1d ftmp_y("ftmp_y",ny2);
-    realHost1d trigxi("trigxi",n3i);
-    realHost1d trigxj("trigxj",n3j);
-    intHost1d  ifaxi ("ifaxi" ,100);
-    intHost1d  ifaxj ("ifaxj" ,100);
     realHost4d fHost = f.createHostCopy();
 
-    yakl::fence();
+    // The FFT factors only depend on the grid size, so compute them once
+    static std::vector<real> trigxi(n3i);
+    static std::vector<real> trigxj(n3j);
+    static std::vector<int>  ifaxi (100);
+    static std::vector<int>  ifaxj (100);
+    static bool fft_factors_computed = false;
+    if (! fft_factors_computed) {
+      fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
+      if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
+      fft_factors_computed = true;
+    }
 
-    fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
-    if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
+    yakl::fence();
 
     for (int k = 0 ; k < nzslab ; k++) {
       for (int j = 0 ; j < ny_gl ; j++) {
@@ -93,24 +96,16 @@ void pressure() {
 
   #endif
 
-  // for(int k=0; k<nzslab; k++) {
-  //  for(int j=0; j<nypp; j++) {
-  //    for(int i=0; i<nx+1; i++) {
-  //      for(int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    ff(k,j,i,icrm) = f(k,j,i,icrm);
-  });
-
-  // for (int k=0; k<nzm; k++) {
-  //  for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
-    a(k,icrm)=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
-    c(k,icrm)=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
-  });
+  // Solve the tridiagonal system in the vertical for each horizontal wave
+  // number, in place in f. The eigenvalues and the matrix coefficients are
+  // computed in the same pass, rather than in separate kernels.
+  // for (int j=0; j<nypp; j++) {
+  //  for (int i=0; i<nx+1; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    SArray<real,1,nzm-1> alfa;
+    SArray<real,1,nzm-1> beta;
 
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
     int jt = 0;
     int it = 0;
 
@@ -125,57 +120,43 @@ void pressure() {
     int id=((i+1)+it-0.1)/2.0;
     real factx = 2.0;
     real xi=id;
-    eign(j,i)=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
-  });
+    real eign=(2.0*cos(factx*xnx*xi)-2.0)*ddx2+(2.0*cos(facty*xny*xj)-2.0)*ddy2;
 
-  // for (int j=0; j<nypp; j++) {
-  //  for (int i=0; i<nx+1; i++) {
-  //    for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
-    SArray<real,1,nzm-1> alfa;
-    SArray<real,1,nzm-1> beta;
-
-    int jt = 0;
-    int it = 0;
-    int jd=((j+1)+jt-0.1)/2.0;
-    int id=((i+1)+it-0.1)/2.0;
     real b;
     if(id+jd == 0) {
-      b=1.0/(eign(j,i)*rho(0,icrm)-a(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      real a0=rhow(0,icrm)/(adz(0,icrm)*adzw(0,icrm)*dz(icrm)*dz(icrm));
+      real c0=rhow(1,icrm)/(adz(0,icrm)*adzw(1,icrm)*dz(icrm)*dz(icrm));
+      b=1.0/(eign*rho(0,icrm)-a0-c0);
+      alfa(0)=-c0*b;
+      beta(0)=f(0,j,i,icrm)*b;
     }
     else {
-      b=1.0/(eign(j,i)*rho(0,icrm)-c(0,icrm));
-      alfa(0)=-c(0,icrm)*b;
-      beta(0)=ff(0,j,i,icrm)*b;
+      real c0=rhow(1,icrm)/(adz(0,icrm)*adzw(1,icrm)*dz(icrm)*dz(icrm));
+      b=1.0/(eign*rho(0,icrm)-c0);
+      alfa(0)=-c0*b;
+      beta(0)=f(0,j,i,icrm)*b;
     }
 
     real e;
     for(int k=1; k<nzm-1; k++) {
-      e=1.0/(eign(j,i)*rho(k,icrm)-a(k,icrm)-c(k,icrm)+a(k,icrm)*alfa(k-1));
-      alfa(k)=-c(k,icrm)*e;
-      beta(k)=(ff(k,j,i,icrm)-a(k,icrm)*beta(k-1))*e;
+      real a=rhow(k,icrm)/(adz(k,icrm)*adzw(k,icrm)*dz(icrm)*dz(icrm));
+      real c=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
+      e=1.0/(eign*rho(k,icrm)-a-c+a*alfa(k-1));
+      alfa(k)=-c*e;
+      beta(k)=(f(k,j,i,icrm)-a*beta(k-1))*e;
     }
-    ff(nzm-1,j,i,icrm)=(ff(nzm-1,j,i,icrm)-a(nzm-1,icrm)*beta(nzm-2))/
-                       (eign(j,i)*rho(nzm-1,icrm)-a(nzm-1,icrm)+a(nzm-1,icrm)*alfa(nzm-2));
+    real a=rhow(nzm-1,icrm)/(adz(nzm-1,icrm)*adzw(nzm-1,icrm)*dz(icrm)*dz(icrm));
+    f(nzm-1,j,i,icrm)=(f(nzm-1,j,i,icrm)-a*beta(nzm-2))/
+                      (eign*rho(nzm-1,icrm)-a+a*alfa(nzm-2));
     for(int k=nzm-2; k>=0; k--) {
-      ff(k,j,i,icrm)=alfa(k)*ff(k+1,j,i,icrm)+beta(k);
+      f(k,j,i,icrm)=alfa(k)*f(k+1,j,i,icrm)+beta(k);
     }
   });
 
-  // for (int k=0; k<nzslab; k++) {
-  //   for (int j=0; j<nypp; j++) {
-  //     for (int i=0; i<nx+1; i++) {
-  //       for (int icrm=0; icrm<ncrms; icrm++) {
-  parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    f(k,j,i,icrm) = ff(k,j,i,icrm);
-  });
-
   #ifndef USE_ORIG_FFT
 
-    if (RUN3D) { pressure_ffty.inverse_real(f); }
-    pressure_fftx.inverse_real(f);
+    if (RUN3D) { crm_fft_plans().pressure_ffty.inverse_real(f); }
+    crm_fft_plans().pressure_fftx.inverse_real(f);
 
   #else
 
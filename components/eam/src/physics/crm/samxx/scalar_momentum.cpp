@@ -108,7 +108,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
       w_hat(k,j,i,icrm) = w_i(k,j,i,icrm);
    });
 
-   esmt_fftx.forward_real(w_hat, 2, nx);
+   crm_fft_plans().esmt_fftx.forward_real(w_hat, 2, nx);
 
    //-----------------------------------------
    //-----------------------------------------
@@ -220,7 +220,7 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    //-----------------------------------------
    // invert fft of pgf_hat to get pgf
    //-----------------------------------------
-   esmt_fftx.inverse_real(pgf_hat);
+   crm_fft_plans().esmt_fftx.inverse_real(pgf_hat);
    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       pgf(k,j,i,icrm) = pgf_hat(k,j,i,icrm);
    });
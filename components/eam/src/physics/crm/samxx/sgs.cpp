@@ -1,7 +1,7 @@
 
 #include "sgs.h"
 
-void kurant_sgs(real &cfl) {
+void kurant_sgs(real1d &cfl_crm) {
   YAKL_SCOPE( sgs_field_diag , :: sgs_field_diag );
   YAKL_SCOPE( dz             , :: dz );
   YAKL_SCOPE( dy             , :: dy );
@@ -36,13 +36,8 @@ void kurant_sgs(real &cfl) {
     real xdir = 0.5*tkhmax(k,icrm)*grdf_x(k,icrm)*dt/(dx*dx);
     real ydir = 0.5*tkhmax(k,icrm)*grdf_y(k,icrm)*dt/(dy*dy)*YES3D;
     real zdir = 0.5*tkhmax(k,icrm)*grdf_z(k,icrm)*dt/(dztmp*dztmp);
-    tkhmax(k,icrm) = max( max( xdir , ydir ) , zdir );
+    yakl::atomicMax( cfl_crm(icrm) , max( max( xdir , ydir ) , zdir ) );
   });
-
-  // Perform a max reduction over tkhmax
-  yakl::ParallelMax<real,yakl::memDevice> pmax( nzm*ncrms );
-  real cfl_loc = pmax( tkhmax.data() );
-  cfl = max(cfl , cfl_loc);
 }
 
 
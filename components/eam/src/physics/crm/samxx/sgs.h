@@ -8,7 +8,7 @@
 #include "microphysics.h"
 #include "diffuse_scalar.h"
 
-void kurant_sgs( real &cfl );
+void kurant_sgs( real1d &cfl_crm );
 
 void sgs_proc();
 
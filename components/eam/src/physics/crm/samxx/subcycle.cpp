@@ -0,0 +1,321 @@
+
+#include "subcycle.h"
+#include <functional>
+#include <map>
+#include <vector>
+
+template <class T, int N> using crmArray = yakl::Array<T,N,yakl::memDevice,yakl::styleC>;
+
+
+// Call f on every per-CRM array that a subcycle (timeloop_cycle() and the
+// routines it calls) writes. A batch gathers these and scatters them back.
+// test/subcycle/check_cycle_arrays.py fails if a per-CRM array used in a
+// subcycle is missing from this list and from for_each_cycle_input().
+template <class F> static void for_each_cycle_state(F &&f) {
+  f( ::bflx                       );
+  f( ::accrsc                     );
+  f( ::accrsi                     );
+  f( ::accrrc                     );
+  f( ::coefice                    );
+  f( ::accrgc                     );
+  f( ::accrgi                     );
+  f( ::evaps1                     );
+  f( ::evaps2                     );
+  f( ::evapr1                     );
+  f( ::evapr2                     );
+  f( ::evapg1                     );
+  f( ::evapg2                     );
+  f( ::micro_field                );
+  f( ::fluxbmk                    );
+  f( ::fluxtmk                    );
+  f( ::mkwle                      );
+  f( ::mkwsb                      );
+  f( ::mkadv                      );
+  f( ::mkdiff                     );
+  f( ::qn                         );
+  f( ::qpsrc                      );
+  f( ::qpevp                      );
+  f( ::u_esmt                     );
+  f( ::v_esmt                     );
+  f( ::u_esmt_sgs                 );
+  f( ::v_esmt_sgs                 );
+  f( ::u_esmt_diff                );
+  f( ::v_esmt_diff                );
+  f( ::fluxb_u_esmt               );
+  f( ::fluxb_v_esmt               );
+  f( ::fluxt_u_esmt               );
+  f( ::fluxt_v_esmt               );
+  f( ::uhl                        );
+  f( ::vhl                        );
+  f( ::taux0                      );
+  f( ::tauy0                      );
+  f( ::sgs_field                  );
+  f( ::sgs_field_diag             );
+  f( ::grdf_x                     );
+  f( ::grdf_y                     );
+  f( ::grdf_z                     );
+  f( ::tkesbbuoy                  );
+  f( ::tkesbshear                 );
+  f( ::tkesbdiss                  );
+  f( ::dt3                        );
+  f( ::at                         );
+  f( ::bt                         );
+  f( ::ct                         );
+  f( ::u                          );
+  f( ::v                          );
+  f( ::w                          );
+  f( ::t                          );
+  f( ::p                          );
+  f( ::tabs                       );
+  f( ::qv                         );
+  f( ::qcl                        );
+  f( ::qpl                        );
+  f( ::qci                        );
+  f( ::qpi                        );
+  f( ::tke2                       );
+  f( ::tk2                        );
+  f( ::dudt                       );
+  f( ::dvdt                       );
+  f( ::dwdt                       );
+  f( ::misc                       );
+  f( ::fluxbu                     );
+  f( ::fluxbv                     );
+  f( ::fluxbt                     );
+  f( ::fluxtt                     );
+  f( ::fzero                      );
+  f( ::precsfc                    );
+  f( ::precssfc                   );
+  f( ::t0                         );
+  f( ::q0                         );
+  f( ::qv0                        );
+  f( ::tabs0                      );
+  f( ::u0                         );
+  f( ::v0                         );
+  f( ::p0                         );
+  f( ::t01                        );
+  f( ::q01                        );
+  f( ::qp0                        );
+  f( ::qn0                        );
+  f( ::utend                      );
+  f( ::vtend                      );
+  f( ::sstxy                      );
+  f( ::prec_xy                    );
+  f( ::cld_xy                     );
+  f( ::usfc_xy                    );
+  f( ::vsfc_xy                    );
+  f( ::twsb                       );
+  f( ::precflux                   );
+  f( ::uwle                       );
+  f( ::uwsb                       );
+  f( ::vwle                       );
+  f( ::vwsb                       );
+  f( ::tkelediss                  );
+  f( ::tdiff                      );
+  f( ::tlat                       );
+  f( ::tlatqi                     );
+  f( ::qifall                     );
+  f( ::qpfall                     );
+  f( ::psfc_xy                    );
+  f( ::swvp_xy                    );
+  f( ::cloudtopheight             );
+  f( ::echotopheight              );
+  f( ::cloudtoptemp               );
+  f( ::t_vt                       );
+  f( ::q_vt                       );
+  f( ::u_vt                       );
+  f( ::t_vt_pert                  );
+  f( ::q_vt_pert                  );
+  f( ::u_vt_pert                  );
+  f( ::crm_output_subcycle_factor );
+  f( ::crm_accel_ceaseflag        );
+}
+
+
+// Call f on every per-CRM array that a subcycle only reads. A batch gathers
+// these but does not scatter them back.
+template <class F> static void for_each_cycle_input(F &&f) {
+  f( ::z0                         );
+  f( ::z                          );
+  f( ::pres                       );
+  f( ::zi                         );
+  f( ::presi                      );
+  f( ::adz                        );
+  f( ::adzw                       );
+  f( ::dz                         );
+  f( ::fluxbq                     );
+  f( ::fluxtu                     );
+  f( ::fluxtv                     );
+  f( ::fluxtq                     );
+  f( ::ug0                        );
+  f( ::vg0                        );
+  f( ::rho                        );
+  f( ::rhow                       );
+  f( ::bet                        );
+  f( ::gamaz                      );
+  f( ::qtend                      );
+  f( ::ttend                      );
+  f( ::fcory                      );
+  f( ::fcorzy                     );
+  f( ::t_vt_tend                  );
+  f( ::q_vt_tend                  );
+  f( ::u_vt_tend                  );
+  f( ::crm_rad_qrad               );
+}
+
+
+// A batch array for n CRMs, shaped like arr, and stored at data
+template <class T> static crmArray<T,1> crm_batch_like(crmArray<T,1> const &arr, T *data, int n) {
+  return crmArray<T,1>("crm_batch",data,n);
+}
+template <class T> static crmArray<T,2> crm_batch_like(crmArray<T,2> const &arr, T *data, int n) {
+  return crmArray<T,2>("crm_batch",data,arr.dimension[0],n);
+}
+template <class T> static crmArray<T,3> crm_batch_like(crmArray<T,3> const &arr, T *data, int n) {
+  return crmArray<T,3>("crm_batch",data,arr.dimension[0],arr.dimension[1],n);
+}
+template <class T> static crmArray<T,4> crm_batch_like(crmArray<T,4> const &arr, T *data, int n) {
+  return crmArray<T,4>("crm_batch",data,arr.dimension[0],arr.dimension[1],arr.dimension[2],n);
+}
+template <class T> static crmArray<T,5> crm_batch_like(crmArray<T,5> const &arr, T *data, int n) {
+  return crmArray<T,5>("crm_batch",data,arr.dimension[0],arr.dimension[1],arr.dimension[2],arr.dimension[3],n);
+}
+
+
+// Number of reals of crm_batch_pool reserved for a batch of arr, which is
+// enough for any number of CRMs up to the full ncrms
+template <class T, int N> static size_t pool_size(crmArray<T,N> const &arr) {
+  return (arr.get_totElems()*sizeof(T) + sizeof(real) - 1) / sizeof(real);
+}
+
+
+// batch(...,ib) = full(...,crms(ib))
+template <class T, int N>
+static void gather_crms(crmArray<T,N> const &full, crmArray<T,N> const &batch, int1d const &crms) {
+  int nfull  = full .dimension[N-1];
+  int nbatch = batch.dimension[N-1];
+  int nrest  = batch.get_totElems() / nbatch;
+  T *full_p  = full .data();
+  T *batch_p = batch.data();
+  parallel_for( SimpleBounds<2>(nrest,nbatch) , YAKL_LAMBDA (int r, int ib) {
+    batch_p[r*nbatch+ib] = full_p[r*nfull+crms(ib)];
+  });
+}
+
+
+// full(...,crms(ib)) = batch(...,ib)
+template <class T, int N>
+static void scatter_crms(crmArray<T,N> const &batch, crmArray<T,N> const &full, int1d const &crms) {
+  int nfull  = full .dimension[N-1];
+  int nbatch = batch.dimension[N-1];
+  int nrest  = batch.get_totElems() / nbatch;
+  T *full_p  = full .data();
+  T *batch_p = batch.data();
+  parallel_for( SimpleBounds<2>(nrest,nbatch) , YAKL_LAMBDA (int r, int ib) {
+    full_p[r*nfull+crms(ib)] = batch_p[r*nbatch+ib];
+  });
+}
+
+
+// Move the Adams-Bashforth entries in slot src(l) of the first dimension to
+// slot l, in place
+template <class T, int N>
+static void permute_ab_slots(crmArray<T,N> const &arr, SArray<int,1,3> const &src) {
+  int nrest = arr.get_totElems() / 3;
+  T *arr_p = arr.data();
+  parallel_for( nrest , YAKL_LAMBDA (int r) {
+    T tmp[3];
+    for (int l=0; l<3; l++) { tmp[l] = arr_p[l*nrest+r]; }
+    for (int l=0; l<3; l++) { arr_p[l*nrest+r] = tmp[src(l)]; }
+  });
+}
+
+
+void subcycle_crms(subcycle_fn cycle) {
+  // Group the CRMs by cycle count. The Adams-Bashforth time step history is
+  // per CRM (dt3, at, bt, ct), so it does not split the groups.
+  std::map<int,std::vector<int>> groups;
+  if (use_crm_subcycle) {
+    auto ncycle_host = ncycle_crm.createHostCopy();
+    for (int icrm=0; icrm<ncrms; icrm++) { groups[ncycle_host(icrm)].push_back(icrm); }
+  }
+
+  if (groups.size() <= 1) {
+    int ncyc = groups.empty() ? ncycle : groups.begin()->first;
+    for (int icyc=1; icyc<=ncyc; icyc++) {
+      cycle(icyc, ncyc);
+    }
+    return;
+  }
+
+  int ncrms_all = ncrms;
+  int na_glob = na;
+  int nb_glob = nb;
+  int nc_glob = nc;
+
+  // The batches live in crm_batch_pool, which is allocated once per crm()
+  // call, with room for every batched array at the full ncrms. A group only
+  // uses the first part of each array's room, so no group allocates memory.
+  if (crm_batch_pool.data() == nullptr) {
+    size_t nreals = ncrms_all;  // CRM indices of the group
+    for_each_cycle_state( [&] (auto &arr) { if (arr.data() != nullptr) { nreals += pool_size(arr); } });
+    for_each_cycle_input( [&] (auto &arr) { if (arr.data() != nullptr) { nreals += pool_size(arr); } });
+    crm_batch_pool = real1d("crm_batch_pool",nreals);
+  }
+  int1d     crms     ("crms",reinterpret_cast<int *>(crm_batch_pool.data()),ncrms_all);
+  intHost1d crms_host("crms_host",ncrms_all);
+
+  for (auto const &group : groups) {
+    int ncyc   = group.first;
+    int nbatch = group.second.size();
+    for (int ib=0; ib<nbatch; ib++) { crms_host(ib) = group.second[ib]; }
+    crms_host.deep_copy_to(crms);
+
+    // Swap the group's CRMs into the global arrays
+    std::vector<std::function<void()>> restore;
+    real *pool_p = crm_batch_pool.data() + ncrms_all;
+    auto swap_in = [&] (auto &arr) {
+      auto full  = arr;
+      auto batch = crm_batch_like(full, reinterpret_cast<decltype(full.data())>(pool_p), nbatch);
+      pool_p += pool_size(full);
+      gather_crms(full, batch, crms);
+      arr = batch;
+      return std::make_pair(full,batch);
+    };
+    for_each_cycle_state( [&] (auto &arr) {
+      if (arr.data() == nullptr) { return; }
+      auto full_batch = swap_in(arr);
+      restore.push_back( [&arr, full_batch, crms] () {
+        scatter_crms(full_batch.second, full_batch.first, crms);
+        arr = full_batch.first;
+      });
+    });
+    for_each_cycle_input( [&] (auto &arr) {
+      if (arr.data() == nullptr) { return; }
+      auto full = swap_in(arr).first;
+      restore.push_back( [&arr, full] () { arr = full; });
+    });
+    ncrms = nbatch;
+
+    for (int icyc=1; icyc<=ncyc; icyc++) {
+      cycle(icyc, ncyc);
+    }
+
+    // The group rotated na, nb, and nc ncyc times. Move its tendencies and
+    // time steps back to the slots named by the indices it started with, so
+    // all CRMs share the same na, nb, and nc after the time step.
+    SArray<int,1,3> src;
+    src(na_glob-1) = na-1;
+    src(nb_glob-1) = nb-1;
+    src(nc_glob-1) = nc-1;
+    permute_ab_slots(::dudt, src);
+    permute_ab_slots(::dvdt, src);
+    permute_ab_slots(::dwdt, src);
+    permute_ab_slots(::dt3 , src);
+    na = na_glob;
+    nb = nb_glob;
+    nc = nc_glob;
+
+    for (auto &r : restore) { r(); }
+    ncrms = ncrms_all;
+  }
+}
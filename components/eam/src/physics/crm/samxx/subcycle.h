@@ -0,0 +1,18 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+
+// One subcycle of the CRM time step: advances the ::ncrms CRMs currently in
+// the global arrays by dt/ncyc and rotates na, nb, and nc.
+typedef void (*subcycle_fn)(int icyc, int ncyc);
+
+// Advance every CRM by dt. Without use_crm_subcycle, every CRM takes the
+// global ncycle subcycles in place. With it, each CRM takes ncycle_crm(icrm)
+// subcycles: the CRMs that share a cycle count are copied into batch arrays
+// (views into crm_batch_pool, allocated once per crm() call)
+// that replace the global arrays while cycle() runs, then copied back. Only
+// the arrays a subcycle uses are batched (see for_each_cycle_state() and
+// for_each_cycle_input(), checked by test/subcycle/check_cycle_arrays.py).
+void subcycle_crms(subcycle_fn cycle);
@@ -9,6 +9,10 @@ printf "\nRebuilding\n\n"
 
 make -j8 || exit -1
 
+printf "\n\nRunning the per-CRM subcycling test\n\n"
+./subcycle/subcycle || exit -1
+python ../subcycle/check_cycle_arrays.py ../.. || exit -1
+
 ################################################################################
 ################################################################################
 
@@ -22,8 +26,10 @@ cd ..
 
 printf "\nRunning C++ code\n\n"
 cd cpp2d
-rm -f cpp_output_000001.nc
+rm -f cpp_output_000001.nc cpp_subcycle_output_000001.nc
 mpirun -n $ntasks ./cpp2d || exit -1
+printf "\nRunning C++ code with per-CRM subcycling (compare the Elapsed Time)\n\n"
+mpirun -n $ntasks ./cpp2d subcycle || exit -1
 cd ..
 
 printf "\nComparing results\n\n"
@@ -42,8 +48,10 @@ cd ..
 
 printf "\nRunning C++ code\n\n"
 cd cpp3d
-rm -f cpp_output_000001.nc
+rm -f cpp_output_000001.nc cpp_subcycle_output_000001.nc
 mpirun -n $ntasks ./cpp3d || exit -1
+printf "\nRunning C++ code with per-CRM subcycling (compare the Elapsed Time)\n\n"
+mpirun -n $ntasks ./cpp3d subcycle || exit -1
 cd ..
 
 printf "\nComparing results\n\n"
@@ -0,0 +1,133 @@
+#!/usr/bin/env python
+#
+# Check that subcycle.cpp batches every per-CRM array a CRM subcycle uses.
+#
+# With use_crm_subcycle, subcycle_crms() advances a group of CRMs by swapping
+# batch copies of the per-CRM arrays into the global arrays. A per-CRM array
+# that the subcycle uses but that subcycle.cpp does not batch would be indexed
+# with the wrong CRMs without any error, so this check fails instead.
+#
+# Usage: check_cycle_arrays.py <samxx source directory>
+
+from __future__ import print_function
+import glob
+import os
+import re
+import sys
+
+# Files whose functions only run outside of timeloop_cycle(). vars.cpp only
+# allocates the arrays. timeloop.cpp is handled separately: only the body of
+# timeloop_cycle() is part of a subcycle.
+outside = ['crm.cpp', 'vars.cpp', 'pre_timeloop.cpp', 'post_timeloop.cpp', 'post_icycle.cpp',
+           'kurant.cpp', 'subcycle.cpp', 'setparm.cpp', 'setperturb.cpp', 'task_init.cpp',
+           'timeloop.cpp']
+
+
+def strip_comments(src):
+  src = re.sub(r'/\*.*?\*/', '', src, flags=re.S)
+  return re.sub(r'//.*', '', src)
+
+
+def matching_paren(src, i):
+  depth = 0
+  for j in range(i, len(src)):
+    if src[j] in '({':
+      depth += 1
+    elif src[j] in ')}':
+      depth -= 1
+      if depth == 0:
+        return j
+  return len(src)
+
+
+def function_body(src, name):
+  m = re.search(r'\b%s\s*\([^;{]*\)\s*\{' % name, src)
+  if m is None:
+    return ''
+  return src[m.end()-1:matching_paren(src, m.end()-1)+1]
+
+
+def per_crm_arrays(vars_src):
+  # Arrays allocated with ncrms or pcols as their last dimension
+  arrays = []
+  for m in re.finditer(r'^\s*(?:::)?(\w+)\s*=\s*(?:real|int|bool)\dd\s*\(\s*"[^"]*"\s*,([^;]*)\)\s*;',
+                       vars_src, re.M):
+    if m.group(2).split(',')[-1].strip() in ('ncrms', 'pcols') and m.group(1) not in arrays:
+      arrays.append(m.group(1))
+  return arrays
+
+
+def listed_arrays(subcycle_src, name):
+  return re.findall(r'f\(\s*::(\w+)\s*\)', function_body(subcycle_src, name))
+
+
+def writes(src, name):
+  # Assignments to name(...), atomic updates of name(...), and any use of name
+  # that is not an element access (passing it to a function, deep_copy, ...)
+  found = []
+  for m in re.finditer(r'\b%s\b' % name, src):
+    line = src[src.rfind('\n', 0, m.start())+1:src.find('\n', m.end())].strip()
+    if 'YAKL_SCOPE' in line:
+      continue
+    i = m.end()
+    while i < len(src) and src[i] in ' \t':
+      i += 1
+    if i == len(src) or src[i] != '(':
+      found.append(line)
+      continue
+    j = matching_paren(src, i) + 1
+    while j < len(src) and src[j] in ' \t':
+      j += 1
+    if (src[j] == '=' and src[j+1] != '=') or src[j:j+2] in ('+=', '-=', '*=', '/='):
+      found.append(line)
+    elif re.search(r'atomic\w+\s*\(\s*$', src[max(0, m.start()-40):m.start()]):
+      found.append(line)
+  return found
+
+
+def main(srcdir):
+  read = lambda f: strip_comments(open(os.path.join(srcdir, f)).read())
+  errors = []
+
+  cycle_src = {}
+  for path in sorted(glob.glob(os.path.join(srcdir, '*.cpp'))):
+    f = os.path.basename(path)
+    if f not in outside:
+      cycle_src[f] = read(f)
+  cycle_src['timeloop.cpp'] = function_body(read('timeloop.cpp'), 'timeloop_cycle')
+  all_cycle_src = '\n'.join(cycle_src.values())
+
+  for f in outside:
+    if f in ('vars.cpp', 'timeloop.cpp'):
+      continue
+    for m in re.finditer(r'^[A-Za-z][\w:<>,\s\*&]*?\b(\w+)\s*\([^;{]*\)\s*\{', read(f), re.M):
+      if re.search(r'\b%s\s*\(' % m.group(1), all_cycle_src):
+        errors.append('%s() in %s is called from a subcycle; remove %s from the outside list'
+                      % (m.group(1), f, f))
+
+  arrays = per_crm_arrays(read('vars.cpp'))
+  state = listed_arrays(read('subcycle.cpp'), 'for_each_cycle_state')
+  inputs = listed_arrays(read('subcycle.cpp'), 'for_each_cycle_input')
+
+  for a in arrays:
+    users = [f for f in sorted(cycle_src) if re.search(r'\b%s\b' % a, cycle_src[f])]
+    if users and a not in state and a not in inputs:
+      errors.append('%s is used in a subcycle (%s) but subcycle.cpp does not batch it'
+                    % (a, ', '.join(users)))
+    if a in inputs:
+      for f in sorted(cycle_src):
+        for line in writes(cycle_src[f], a):
+          errors.append('%s is listed as a subcycle input but %s writes it: %s' % (a, f, line))
+  for a in state + inputs:
+    if a not in arrays:
+      errors.append('subcycle.cpp batches %s, which is not a per-CRM array in vars.cpp' % a)
+
+  for e in errors:
+    print('check_cycle_arrays: ' + e)
+  print('check_cycle_arrays: %d per-CRM arrays, %d batched state, %d batched inputs: %s'
+        % (len(arrays), len(state), len(inputs), 'FAIL' if errors else 'PASS'))
+  return 1 if errors else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', '..')))
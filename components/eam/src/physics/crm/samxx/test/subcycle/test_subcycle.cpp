@@ -0,0 +1,133 @@
+
+#include "subcycle.h"
+
+// Stand-in for timeloop_cycle(): counts the subcycles of each CRM, advances u
+// by dtn, stores the subcycle index as the newest u tendency, and records dtn
+// as the newest subcycle time step.
+void test_cycle(int icyc, int ncyc) {
+  YAKL_SCOPE( crm_output_subcycle_factor , ::crm_output_subcycle_factor );
+  YAKL_SCOPE( u                          , ::u );
+  YAKL_SCOPE( dudt                       , ::dudt );
+  YAKL_SCOPE( dt3                        , ::dt3 );
+  YAKL_SCOPE( ncrms                      , ::ncrms );
+
+  real dtn  = dt/ncyc;
+  int  na_c = na;
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)+1;
+    u(0,0,0,icrm) = u(0,0,0,icrm) + dtn;
+    dudt(na_c-1,0,0,0,icrm) = icyc;
+    dt3(na_c-1,icrm) = dtn;
+  });
+
+  int nn=na;
+  na=nc;
+  nc=nb;
+  nb=nn;
+}
+
+
+// Advance three CRMs, the middle one needing three subcycles and the others
+// one, and check that each took ncycle_expect(icrm) subcycles
+int run_case(bool per_crm, SArray<int,1,3> const &ncycle_expect) {
+  int nerr = 0;
+  use_crm_subcycle = per_crm;
+  ncrms  = 3;
+  pcols  = 3;
+  dt     = 10.;
+  nstep  = 1;
+  na     = 1;
+  nb     = 2;
+  nc     = 3;
+  ncycle = 3;
+
+  ncycle_crm                 = int1d ("ncycle_crm"                ,ncrms);
+  crm_output_subcycle_factor = real1d("crm_output_subcycle_factor",pcols);
+  u                          = real4d("u"                         ,1,1,1,ncrms);
+  dudt                       = real5d("dudt"                      ,3,1,1,1,ncrms);
+  dvdt                       = real5d("dvdt"                      ,3,1,1,1,ncrms);
+  dwdt                       = real5d("dwdt"                      ,3,1,1,1,ncrms);
+  dt3                        = real2d("dt3"                       ,3,ncrms);
+  yakl::memset(crm_output_subcycle_factor,0.);
+  yakl::memset(u   ,0.);
+  yakl::memset(dudt,0.);
+  yakl::memset(dvdt,0.);
+  yakl::memset(dwdt,0.);
+  yakl::memset(dt3 ,0.);
+
+  // Without use_crm_subcycle, kurant() sets every ncycle_crm to ncycle
+  intHost1d ncycle_host("ncycle_host",ncrms);
+  for (int icrm=0; icrm<ncrms; icrm++) { ncycle_host(icrm) = ncycle_expect(icrm); }
+  ncycle_host.deep_copy_to(ncycle_crm);
+
+  subcycle_crms(test_cycle);
+
+  if (ncrms != 3 || na != 1 || nb != 2 || nc != 3) {
+    std::cout << "subcycle: ncrms or the Adams-Bashforth indices were not restored" << std::endl;
+    nerr++;
+  }
+
+  auto factor_host = crm_output_subcycle_factor.createHostCopy();
+  auto u_host      = u.createHostCopy();
+  auto dudt_host   = dudt.createHostCopy();
+  auto dt3_host    = dt3.createHostCopy();
+  for (int icrm=0; icrm<ncrms; icrm++) {
+    int ncyc = ncycle_expect(icrm);
+    // Every CRM takes exactly its own number of subcycles...
+    if (factor_host(icrm) != ncyc) {
+      std::cout << "subcycle: CRM " << icrm << " took " << factor_host(icrm) << " subcycles, expected "
+                << ncyc << std::endl;
+      nerr++;
+    }
+    // ...and still advances by the full dt
+    if (abs(u_host(0,0,0,icrm) - dt) > 1.e-12*dt) {
+      std::cout << "subcycle: CRM " << icrm << " advanced by " << u_host(0,0,0,icrm) << ", expected "
+                << dt << std::endl;
+      nerr++;
+    }
+    // The newest tendencies and time steps are in the nb and nc slots, as if
+    // all CRMs had rotated together
+    if (dudt_host(nb-1,0,0,0,icrm) != ncyc || dudt_host(nc-1,0,0,0,icrm) != ncyc-1) {
+      std::cout << "subcycle: CRM " << icrm << " has its Adams-Bashforth tendencies in the wrong slots" << std::endl;
+      nerr++;
+    }
+    if (dt3_host(nb-1,icrm) != dt/ncyc || dt3_host(nc-1,icrm) != (ncyc >= 2 ? dt/ncyc : 0.)) {
+      std::cout << "subcycle: CRM " << icrm << " has its Adams-Bashforth time steps in the wrong slots" << std::endl;
+      nerr++;
+    }
+  }
+
+  ncycle_crm                 = int1d();
+  crm_output_subcycle_factor = real1d();
+  u                          = real4d();
+  dudt                       = real5d();
+  dvdt                       = real5d();
+  dwdt                       = real5d();
+  dt3                        = real2d();
+  return nerr;
+}
+
+
+int main() {
+  yakl::init();
+  int nerr = 0;
+  {
+    // Per-CRM subcycling: each CRM takes its own number of subcycles
+    SArray<int,1,3> ncycle_per_crm;
+    ncycle_per_crm(0) = 1;
+    ncycle_per_crm(1) = 3;
+    ncycle_per_crm(2) = 1;
+    nerr += run_case(true, ncycle_per_crm);
+
+    // Default: every CRM takes the global ncycle subcycles in place
+    SArray<int,1,3> ncycle_global;
+    ncycle_global(0) = 3;
+    ncycle_global(1) = 3;
+    ncycle_global(2) = 3;
+    nerr += run_case(false, ncycle_global);
+  }
+  yakl::finalize();
+
+  std::cout << "subcycle: " << (nerr == 0 ? "PASS" : "FAIL") << std::endl;
+  return nerr == 0 ? 0 : -1;
+}
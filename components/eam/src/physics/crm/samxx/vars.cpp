@@ -86,7 +86,10 @@ void allocate() {
   adz              = real2d( "adz             "                        , nzm    , ncrms ); 
   adzw             = real2d( "adzw            "                        , nz     , ncrms ); 
   dz               = real1d( "dz              "                                 , ncrms ); 
-  dt3              = real1d( "dt3             " , 3                                     ); 
+  dt3              = real2d( "dt3             " , 3                             , ncrms ); 
+  at               = real1d( "at              "                                 , ncrms ); 
+  bt               = real1d( "bt              "                                 , ncrms ); 
+  ct               = real1d( "ct              "                                 , ncrms ); 
   u                = real4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
   v                = real4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
   w                = real4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
@@ -268,6 +271,9 @@ void allocate() {
   yakl::memset(adzw              ,0.);
   yakl::memset(dz                ,0.);
   yakl::memset(dt3               ,0.);
+  yakl::memset(at                ,0.);
+  yakl::memset(bt                ,0.);
+  yakl::memset(ct                ,0.);
   yakl::memset(u                 ,0.);
   yakl::memset(v                 ,0.);
   yakl::memset(w                 ,0.);
@@ -551,7 +557,10 @@ void finalize() {
   adz              = real2d(); 
   adzw             = real2d(); 
   dz               = real1d(); 
-  dt3              = real1d(); 
+  dt3              = real2d(); 
+  at               = real1d(); 
+  bt               = real1d(); 
+  ct               = real1d(); 
   u                = real4d();
   v                = real4d();
   w                = real4d();
@@ -669,11 +678,16 @@ void finalize() {
 
   yakl::fence();
 
-  pressure_fftx.cleanup();
-  pressure_ffty.cleanup();
-  vt_fftx.cleanup();
-  vt_ffty.cleanup();
-  esmt_fftx.cleanup();
+  for (auto &plans : fft_plans) {
+    plans.second.pressure_fftx.cleanup();
+    plans.second.pressure_ffty.cleanup();
+    plans.second.vt_fftx.cleanup();
+    plans.second.vt_ffty.cleanup();
+    plans.second.esmt_fftx.cleanup();
+  }
+  fft_plans.clear();
+
+  crm_batch_pool = real1d();
 }
 
 
@@ -836,6 +850,8 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p, r
   ::lat0                      = real1d( "lat0                    "                                , ncrms); 
   ::long0                     = real1d( "long0                   "                                , ncrms); 
   ::gcolp                     = int1d ( "gcolp                   "                                , ncrms); 
+  ::ncycle_crm                = int1d ( "ncycle_crm              "                                , ncrms); 
+  ::crm_accel_ceaseflag       = bool1d( "crm_accel_ceaseflag     "                                , ncrms); 
 
   // Copy inputs from host Array to device Array
   crm_input_bflxls        .deep_copy_to(::crm_input_bflxls        );
@@ -1372,6 +1388,8 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   ::lat0                      = real1d();
   ::long0                     = real1d();
   ::gcolp                     = int1d();
+  ::ncycle_crm                = int1d();
+  ::crm_accel_ceaseflag       = bool1d();
 }
 
 
@@ -1643,7 +1661,7 @@ real2d zi              ;
 real2d presi           ;
 real2d adz             ;
 real2d adzw            ;
-real1d dt3             ;
+real2d dt3             ;
 real1d dz              ;
 
 real5d sgs_field       ;
@@ -1827,6 +1845,7 @@ int2d crm_clear_rh_cnt;
 real1d lat0; 
 real1d long0;
 int1d  gcolp;
+int1d  ncycle_crm;
 
 
 int pcols;
@@ -1836,7 +1855,7 @@ int  nstep                    ;
 int  ncycle                   ;
 int  icycle                   ;
 int  na, nb, nc               ;
-real at, bt, ct               ;
+real1d at, bt, ct             ;
 real dtn                      ;
 real dtfactor                 ;
 int  rank                     ;
@@ -1958,6 +1977,8 @@ bool crm_accel_uv;
 bool use_crm_accel;
 real crm_accel_factor;
 
+bool use_crm_subcycle;
+
 real factor_xy;
 real factor_xyt;
 real idt_gl;
@@ -1969,15 +1990,16 @@ real icrm_run_time;
 real dt_glob;
 
 
-bool crm_accel_ceaseflag;
+bool1d crm_accel_ceaseflag;
 
 int igstep;
 
-yakl::RealFFT1D<real> pressure_fftx;
-yakl::RealFFT1D<real> pressure_ffty;
-yakl::RealFFT1D<real> vt_fftx;
-yakl::RealFFT1D<real> vt_ffty;
-yakl::RealFFT1D<real> esmt_fftx;
+std::map<int,CRMFFTPlans> fft_plans;
+real1d crm_batch_pool;
+
+CRMFFTPlans &crm_fft_plans() {
+  return fft_plans[ncrms];
+}
 
 
 
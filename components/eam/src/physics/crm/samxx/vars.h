@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "YAKL_fft.h"
+#include <map>
 
 
 void allocate();
@@ -119,7 +120,7 @@ extern int  nstep                    ;
 extern int  ncycle                   ;
 extern int  icycle                   ;
 extern int  na, nb, nc               ;
-extern real at, bt, ct               ;
+extern real1d at, bt, ct             ;
 extern real dtn                      ;
 extern real dtfactor                 ;
 extern int  rank                     ;
@@ -241,6 +242,10 @@ extern bool crm_accel_uv;
 extern bool use_crm_accel;
 extern real crm_accel_factor;
 
+// Subcycle each CRM with its own cycle count (ncycle_crm) instead of the
+// global ncycle. Off by default, which matches the Fortran SAM.
+extern bool use_crm_subcycle;
+
 extern real4d tabs            ;
 extern real4d qv              ;
 extern real4d qcl             ;
@@ -353,7 +358,7 @@ extern real2d zi              ;
 extern real2d presi           ;
 extern real2d adz             ;
 extern real2d adzw            ;
-extern real1d dt3             ;
+extern real2d dt3             ;
 extern real1d dz              ;
 
 extern real2d grdf_x          ;
@@ -536,6 +541,9 @@ extern int2d  crm_clear_rh_cnt;
 extern real1d lat0; 
 extern real1d long0;
 extern int1d  gcolp;
+// Number of subcycles each CRM needs to satisfy its own CFL criterion.
+// ncycle is the max over all CRMs.
+extern int1d  ncycle_crm;
 
 extern real factor_xy;
 extern real factor_xyt;
@@ -548,13 +556,27 @@ extern real icrm_run_time;
 extern real dt_glob;
 
 
-extern bool crm_accel_ceaseflag;
+// Mean-state acceleration has been turned off for this CRM
+extern bool1d crm_accel_ceaseflag;
 
 extern int igstep;
 
-extern yakl::RealFFT1D<real> pressure_fftx;
-extern yakl::RealFFT1D<real> pressure_ffty;
-extern yakl::RealFFT1D<real> vt_fftx;
-extern yakl::RealFFT1D<real> vt_ffty;
-extern yakl::RealFFT1D<real> esmt_fftx;
+// FFT plans are sized for the number of CRMs they are first used with, so
+// there is one set per batch size (see subcycle_crms()). They are destroyed
+// in finalize().
+struct CRMFFTPlans {
+  yakl::RealFFT1D<real> pressure_fftx;
+  yakl::RealFFT1D<real> pressure_ffty;
+  yakl::RealFFT1D<real> vt_fftx;
+  yakl::RealFFT1D<real> vt_ffty;
+  yakl::RealFFT1D<real> esmt_fftx;
+};
+extern std::map<int,CRMFFTPlans> fft_plans;
+
+// The FFT plans for the current ncrms
+CRMFFTPlans &crm_fft_plans();
+
+// Device memory for the CRM batches of subcycle_crms(), allocated on first
+// use and released in finalize(), so that it is reused by all time steps
+extern real1d crm_batch_pool;
 
@@ -9,6 +9,7 @@
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -153,6 +154,22 @@ init_scorpio(const int atm_id)
   // In CIME runs, gptl is already inited. In standalone runs, it might
   // not be, depending on what scorpio does.
   init_gptl(m_gptl_externally_handled);
+  auto& driver_options = m_atm_params.sublist("driver_options");
+  set_timer_level(driver_options.get<int>("timer_level",0));
+
+  // Timing scopes fence the device, so only record them if they are written at finalize
+  set_timing_scopes_enabled(driver_options.get("write_timing_summary",false) or
+                            driver_options.get("write_per_rank_timing",false));
+
+  // Optional per-step time series of selected timers
+  const int step_timing_size = driver_options.get<int>("step_timing_buffer_size",0);
+  if (step_timing_size>0) {
+    using vos_t = std::vector<std::string>;
+    const auto timers = driver_options.get<vos_t>("step_timing_timers",vos_t{});
+    m_step_timing = std::make_shared<StepTimingSeries>(timers,step_timing_size);
+    m_straggler_tolerance = driver_options.get<double>("straggler_tolerance",0.5);
+    m_straggler_check_freq = driver_options.get<int>("straggler_check_frequency",0);
+  }
 
   m_ad_status |= s_scorpio_inited;
 }
@@ -630,7 +647,9 @@ void AtmosphereDriver::initialize_output_managers () {
     checkpoint_params.set("Frequency",restart_pl.sublist("output_control").get<int>("Frequency"));
   }
 
-  // Build one manager per output yaml file
+  // Build one manager per output yaml file. All of them share the same diagnostics,
+  // so that a diag requested by several streams is computed only once per step.
+  auto diag_cache = std::make_shared<DiagnosticCache>();
   using vos_t = std::vector<std::string>;
   const auto& output_yaml_files = io_params.get<vos_t>("output_yaml_files",vos_t{});
   int om_tally = 0;
@@ -650,6 +669,7 @@ void AtmosphereDriver::initialize_output_managers () {
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
     om.set_logger(m_atm_logger);
+    om.set_diagnostic_cache(diag_cache);
     om.setup(m_atm_comm,params,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,false);
   }
 
@@ -1234,11 +1254,15 @@ void AtmosphereDriver::initialize_atm_procs ()
   start_timer("EAMxx::init");
   start_timer("EAMxx::initialize_atm_procs");
 
-  // Initialize memory buffer for all atm processes
+  // Initialize memory buffer for all atm processes. Each atm proc gets its own
+  // portion of the buffer, which is shared with atm procs that never run at the same time
   m_memory_buffer = std::make_shared<ATMBufferManager>();
-  m_memory_buffer->request_bytes(m_atm_process_group->requested_buffer_size_in_bytes());
+  m_atm_process_group->request_buffers(*m_memory_buffer);
   m_memory_buffer->allocate();
   m_atm_process_group->init_buffers(*m_memory_buffer);
+  m_atm_logger->info("[EAMxx::init] atm procs buffer: " + std::to_string(m_memory_buffer->allocated_bytes())
+                     + " bytes (largest request: " + std::to_string(m_memory_buffer->max_request_bytes()) + " bytes)");
+  m_atm_logger->debug("[EAMxx] " + m_memory_buffer->report());
 
   const bool restarted_run = m_case_t0 < m_run_t0;
 
@@ -1302,6 +1326,10 @@ initialize (const ekat::Comm& atm_comm,
 
 void AtmosphereDriver::run (const int dt) {
   start_timer("EAMxx::run");
+  TimingScope timing_scope("EAMxx::run");
+  if (m_step_timing) {
+    m_step_timing->start_step();
+  }
 
   // Zero out accumulated fields
   reset_accummulated_fields();
@@ -1322,8 +1350,13 @@ void AtmosphereDriver::run (const int dt) {
   m_current_ts += dt;
 
   // Update output streams
-  for (auto& out_mgr : m_output_managers) {
-    out_mgr.run(m_current_ts);
+  {
+    start_timer("EAMxx::output");
+    TimingScope output_scope("EAMxx::output");
+    for (auto& out_mgr : m_output_managers) {
+      out_mgr.run(m_current_ts);
+    }
+    stop_timer("EAMxx::output");
   }
 
 #ifdef SCREAM_HAS_MEMORY_USAGE
@@ -1333,6 +1366,14 @@ void AtmosphereDriver::run (const int dt) {
   m_atm_logger->info("[EAMxx::run] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
 
+  // Record the step timing, and every few steps warn about ranks much slower than the others
+  if (m_step_timing) {
+    m_step_timing->record_step(m_current_ts.get_num_steps());
+    if (m_straggler_check_freq>0 and m_step_timing->num_unchecked_steps()==m_straggler_check_freq) {
+      report_stragglers();
+    }
+  }
+
   // Flush the logger at least once per time step.
   // Without this flush, depending on how much output we are loggin,
   // it might be several time steps before the file is updated.
@@ -1342,6 +1383,16 @@ void AtmosphereDriver::run (const int dt) {
   stop_timer("EAMxx::run");
 }
 
+void AtmosphereDriver::report_stragglers () {
+  const int nsteps = m_step_timing->num_unchecked_steps();
+  for (int rank : m_step_timing->find_stragglers(m_atm_comm,m_straggler_tolerance)) {
+    m_atm_logger->log(ekat::logger::LogLevel::warn,
+      "[EAMxx] rank " + std::to_string(rank) + " is a straggler: its time over the last "
+      + std::to_string(nsteps) + " steps exceeds the median by more than "
+      + std::to_string(100*m_straggler_tolerance) + "%\n");
+  }
+}
+
 void AtmosphereDriver::finalize ( /* inputs? */ ) {
   start_timer("EAMxx::finalize");
 
@@ -1361,6 +1412,10 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
   m_atm_process_group->finalize( /* inputs ? */ );
   m_atm_process_group = nullptr;
 
+  // Complete any async IO task (output writes, input prefetches), and stop
+  // the IO thread, while MPI is still initialized
+  scorpio::AsyncIOQueue::instance().finalize();
+
   // Destroy the buffer manager
   m_memory_buffer = nullptr;
 
@@ -1376,6 +1431,22 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     it.second->clean_up();
   }
 
+  // Write structured timing data (see scream_timing.hpp)
+  auto& driver_options = m_atm_params.sublist("driver_options");
+  if (driver_options.get("write_timing_summary",false)) {
+    write_timing_summary_to_json (m_atm_comm,"scream_timing_summary.json");
+  }
+  if (driver_options.get("write_per_rank_timing",false)) {
+    write_timing_scopes_to_json ("scream_timing." + std::to_string(m_atm_comm.rank()) + ".json");
+  }
+  if (m_step_timing) {
+    if (m_step_timing->num_unchecked_steps()>0) {
+      report_stragglers();
+    }
+    m_step_timing->write_csv ("scream_step_timing." + std::to_string(m_atm_comm.rank()) + ".csv");
+    m_step_timing = nullptr;
+  }
+
   // Write all timers to file, and possibly finalize gptl
   if (not m_gptl_externally_handled) {
     write_timers_to_file (m_atm_comm,"scream_timing.txt");
@@ -5,6 +5,7 @@
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "share/util/scream_timing.hpp"
 #include "share/scream_types.hpp"
 #include "share/io/scream_output_manager.hpp"
 #include "share/io/scorpio_input.hpp"
@@ -157,6 +158,9 @@ protected:
 
   void report_res_dep_memory_footprint () const;
 
+  // Warn about ranks much slower than the others over the steps since the last check
+  void report_stragglers ();
+
   void create_logger ();
   void set_initial_conditions ();
   void restart_model ();
@@ -230,6 +234,11 @@ protected:
   // Whether GPTL must be finalized by the AD (in certain standalone runs)
   bool m_gptl_externally_handled;
 
+  // Per-step timing of selected timers (only if requested)
+  std::shared_ptr<StepTimingSeries> m_step_timing;
+  double m_straggler_tolerance;
+  int    m_straggler_check_freq;  // In steps. If 0, only check at finalize
+
   // Current ad initialization status
   int m_ad_status = 0;
 
@@ -828,6 +828,8 @@ void HommeDynamics::init_homme_views () {
   msg << "   transport_alg: " << params.transport_alg << "\n";
   msg << "   disable_diagnostics: " << (params.disable_diagnostics ? "yes" : "no") << "\n";
   msg << "   theta_hydrostatic_mode: " << (params.theta_hydrostatic_mode ? "yes" : "no") << "\n";
+  msg << "   dirk_active_set: " << (params.dirk_active_set ? "yes" : "no") << "\n";
+  msg << "   caar_overlap_exchange: " << (params.caar_overlap_exchange ? "yes" : "no") << "\n";
   msg << "   prescribed_wind: " << (params.prescribed_wind ? "yes" : "no") << "\n";
 
   msg << "\n************** General run info **********************\n\n";
@@ -53,33 +53,18 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   FieldLayout scalar3d_layout_mid { {COL,LEV}, {m_num_cols, m_num_src_levs} };
   FieldLayout horiz_wind_layout { {COL,CMP,LEV}, {m_num_cols,2,m_num_src_levs} };
   fields_ext["T_mid"] = view_2d<Real>("T_mid",m_num_cols,m_num_src_levs);
-  fields_ext_h["T_mid"]       = Kokkos::create_mirror_view(fields_ext["T_mid"]);
-  auto T_mid_h=fields_ext_h["T_mid"];
-  host_views["T_mid"] = view_1d_host<Real>(T_mid_h.data(),T_mid_h.size());
   layouts.emplace("T_mid", scalar3d_layout_mid);
 
   fields_ext["p_mid"] = view_2d<Real>("p_mid",m_num_cols,m_num_src_levs);
-  fields_ext_h["p_mid"]       = Kokkos::create_mirror_view(fields_ext["p_mid"]);
-  auto p_mid_h=fields_ext_h["p_mid"];
-  host_views["p_mid"] = view_1d_host<Real>(p_mid_h.data(),p_mid_h.size());
   layouts.emplace("p_mid", scalar3d_layout_mid);
   
   fields_ext["qv"] = view_2d<Real>("qv",m_num_cols,m_num_src_levs);
-  fields_ext_h["qv"]       = Kokkos::create_mirror_view(fields_ext["qv"]);
-  auto qv_h=fields_ext_h["qv"];
-  host_views["qv"] = view_1d_host<Real>(qv_h.data(),qv_h.size());
   layouts.emplace("qv", scalar3d_layout_mid);
 
   fields_ext["u"] = view_2d<Real>("u",m_num_cols,m_num_src_levs);
-  fields_ext_h["u"]       = Kokkos::create_mirror_view(fields_ext["u"]);
-  auto u_h=fields_ext_h["u"];
-  host_views["u"] = view_1d_host<Real>(u_h.data(),u_h.size());
   layouts.emplace("u", scalar3d_layout_mid);
 
   fields_ext["v"] = view_2d<Real>("v",m_num_cols,m_num_src_levs);
-  fields_ext_h["v"]       = Kokkos::create_mirror_view(fields_ext["v"]);
-  auto v_h=fields_ext_h["v"];
-  host_views["v"] = view_1d_host<Real>(v_h.data(),v_h.size());
   layouts.emplace("v", scalar3d_layout_mid);
 
   auto grid_l = m_grid->clone("Point Grid", false);
@@ -91,7 +76,9 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   // We need to skip grid checks because multiple ranks 
   // may want the same column of source data.
   data_in_params.set("Skip_Grid_Checks",true);  
-  data_input.init(data_in_params,grid_l,host_views,layouts);
+  // Optionally, prefetch the next time slab on the async IO thread (see TimeSlabReader)
+  data_in_params.set("async_prefetch",m_params.get<bool>("async_prefetch",false));
+  data_reader = std::make_shared<TimeSlabReader>(data_in_params,grid_l,layouts);
 
   T_mid_ext = fields_ext["T_mid"];
   p_mid_ext = fields_ext["p_mid"];
@@ -129,110 +116,35 @@ void Nudging::initialize_impl (const RunType /* run_type */)
 		   "ERROR: The start second from the nudging file is "\
 		   "different than the internal simulation start second\n");
 		   
-  //Initialize before and after data
-  NudgingData_bef.init(m_num_cols,m_num_src_levs,true);
-  NudgingData_bef.time = -999;
-  NudgingData_aft.init(m_num_cols,m_num_src_levs,true);
-  NudgingData_aft.time = -999;
-
-  //Read in the first time step
-  data_input.read_variables(0);
-  Kokkos::deep_copy(NudgingData_bef.T_mid,fields_ext_h["T_mid"]);
-  Kokkos::deep_copy(NudgingData_bef.p_mid,fields_ext_h["p_mid"]);
-  Kokkos::deep_copy(NudgingData_bef.u,fields_ext_h["u"]);
-  Kokkos::deep_copy(NudgingData_bef.v,fields_ext_h["v"]);
-  Kokkos::deep_copy(NudgingData_bef.qv,fields_ext_h["qv"]);
-  NudgingData_bef.time = 0.;
-
-  //Read in the first time step
-  data_input.read_variables(1);
-  Kokkos::deep_copy(NudgingData_aft.T_mid,fields_ext_h["T_mid"]);
-  Kokkos::deep_copy(NudgingData_aft.p_mid,fields_ext_h["p_mid"]);
-  Kokkos::deep_copy(NudgingData_aft.u,fields_ext_h["u"]);
-  Kokkos::deep_copy(NudgingData_aft.v,fields_ext_h["v"]);
-  Kokkos::deep_copy(NudgingData_aft.qv,fields_ext_h["qv"]);
-  NudgingData_aft.time = time_step_file;
-
+  //Read in the first two time steps
+  data_reader->load(0);
+  data_reader->load(1);
 }
 
 void Nudging::time_interpolation (const int time_s) {
 
-  using KT = KokkosTypes<DefaultDevice>;
-  using ExeSpace = typename KT::ExeSpace;
-  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
-  using MemberType = typename KT::MemberType;
-  
   const int time_index = time_s/time_step_file;
   double time_step_file_d = time_step_file;
   double w_bef = ((time_index+1)*time_step_file-time_s) / time_step_file_d;
-  double w_aft = (time_s-(time_index)*time_step_file) / time_step_file_d;
-  const int num_cols = NudgingData_aft.T_mid.extent(0);
-  const int num_vert_packs = NudgingData_aft.T_mid.extent(1);
-  const auto policy = ESU::get_default_team_policy(num_cols, num_vert_packs);
-
-  auto T_mid_bef = NudgingData_bef.T_mid;
-  auto T_mid_aft = NudgingData_aft.T_mid;
-  auto u_bef = NudgingData_bef.u;
-  auto u_aft = NudgingData_aft.u;
-  auto v_bef = NudgingData_bef.v;
-  auto v_aft = NudgingData_aft.v;
-  auto p_mid_bef = NudgingData_bef.p_mid;
-  auto p_mid_aft = NudgingData_aft.p_mid;
-  auto qv_bef = NudgingData_bef.qv;
-  auto qv_aft = NudgingData_aft.qv;
-
-  Kokkos::parallel_for("nudging_time_interpolation", policy,
-     	       KOKKOS_LAMBDA(MemberType const& team) {
-
-      const int icol = team.league_rank();
-      auto T_mid_1d = ekat::subview(T_mid_ext,icol);
-      auto T_mid_bef_1d = ekat::subview(T_mid_bef,icol);
-      auto T_mid_aft_1d = ekat::subview(T_mid_aft,icol);
-      auto u_1d = ekat::subview(u_ext,icol);
-      auto u_bef_1d = ekat::subview(u_bef,icol);
-      auto u_aft_1d = ekat::subview(u_aft,icol);
-      auto v_1d = ekat::subview(v_ext,icol);
-      auto v_bef_1d = ekat::subview(v_bef,icol);
-      auto v_aft_1d = ekat::subview(v_aft,icol);
-      auto p_mid_1d = ekat::subview(p_mid_ext,icol);
-      auto p_mid_bef_1d = ekat::subview(p_mid_bef,icol);
-      auto p_mid_aft_1d = ekat::subview(p_mid_aft,icol);
-      auto qv_1d = ekat::subview(qv_ext,icol);
-      auto qv_bef_1d = ekat::subview(qv_bef,icol);
-      auto qv_aft_1d = ekat::subview(qv_aft,icol);
 
-      const auto range = Kokkos::TeamThreadRange(team, num_vert_packs);
-      Kokkos::parallel_for(range, [&] (const Int & k) {
-	  T_mid_1d(k)=w_bef*T_mid_bef_1d(k) + w_aft*T_mid_aft_1d(k);
-	  p_mid_1d(k)=w_bef*p_mid_bef_1d(k) + w_aft*p_mid_aft_1d(k);
-	  u_1d(k)=w_bef*u_bef_1d(k) + w_aft*u_aft_1d(k);
-	  v_1d(k)=w_bef*v_bef_1d(k) + w_aft*v_aft_1d(k);
-	  qv_1d(k)=w_bef*qv_bef_1d(k) + w_aft*qv_aft_1d(k);
-      });
-      team.team_barrier();
-  });
-  Kokkos::fence();   
+  for (const auto& name : m_fnames) {
+    auto& ext = fields_ext[name];
+    const TimeSlabReader::view_1d_dev ext_1d(ext.data(),ext.size());
+    data_reader->interpolate(name,time_index,time_index+1,w_bef,ext_1d);
+  }
 }
 
 // =========================================================================================
 void Nudging::update_time_step (const int time_s)
 {
-  //Check to see in time state needs to be updated
-  if (time_s >= NudgingData_aft.time)
-    {
-      const int time_index = time_s/time_step_file;
-      std::swap (NudgingData_bef,NudgingData_aft);
-      NudgingData_bef.time = NudgingData_aft.time;
-
-      data_input.read_variables(time_index+1);
-      Kokkos::deep_copy(NudgingData_aft.T_mid,fields_ext_h["T_mid"]);
-      Kokkos::deep_copy(NudgingData_aft.p_mid,fields_ext_h["p_mid"]);
-      Kokkos::deep_copy(NudgingData_aft.u,fields_ext_h["u"]);
-      Kokkos::deep_copy(NudgingData_aft.v,fields_ext_h["v"]);
-      Kokkos::deep_copy(NudgingData_aft.qv,fields_ext_h["qv"]);
-      NudgingData_aft.time = time_step_file*(time_index+1);
-    }
-  
+  //Make sure the slabs bracketing the current time are on device (they are
+  //usually already there, from a previous step or from the prefetch)
+  const int time_index = time_s/time_step_file;
+  data_reader->load(time_index);
+  data_reader->load(time_index+1);
+
+  //Start reading the next slab, so it is ready when we cross into it
+  data_reader->prefetch(time_index+2);
 }
 
   
@@ -346,7 +258,7 @@ void Nudging::run_impl (const double dt)
 // =========================================================================================
 void Nudging::finalize_impl()
 {
-  data_input.finalize();
+  data_reader->finalize();
 }
 
 } // namespace scream
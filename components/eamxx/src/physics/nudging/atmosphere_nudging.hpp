@@ -7,6 +7,7 @@
 #include "share/io/scream_output_manager.hpp"
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_time_slab_reader.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
@@ -54,6 +55,9 @@ public:
   // The name of the subcomponent
   std::string name () const { return "Nudging"; }
 
+  // Nudging reads the nudging data while running
+  bool does_io_in_run () const { return true; }
+
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
@@ -83,20 +87,19 @@ protected:
   int m_num_src_levs;
   int time_step_file;
   std::string datafile;
-  std::map<std::string,view_1d_host<Real>> host_views;
   std::map<std::string,FieldLayout>  layouts;
   std::vector<std::string> m_fnames;
   std::map<std::string,view_2d<Real>> fields_ext;
-  std::map<std::string,view_2d_host<Real>> fields_ext_h;
   view_2d<Real> T_mid_ext;
   view_2d<Real> p_mid_ext;
   view_2d<Real> qv_ext;
   view_2d<Real> u_ext;
   view_2d<Real> v_ext;
   TimeStamp ts0;
-  NudgingFunc::NudgingData NudgingData_bef;
-  NudgingFunc::NudgingData NudgingData_aft;
-  AtmosphereInput data_input;
+  // Reads the nudging data, keeping the slabs bracketing the current time
+  // on device, and prefetching the next one. The nudging data file stays
+  // open until finalize_impl.
+  std::shared_ptr<TimeSlabReader> data_reader;
 }; // class Nudging
 
 } // namespace scream
@@ -318,8 +318,15 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
     p3_postproc.set_mass_and_energy_fluxes(vapor_flux, water_flux, ice_flux, heat_flux);
   }
 
-  // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  // Load tables. Caching the parsed ice table is opt-in, and the cache goes in a
+  // user-provided directory (e.g., the run directory), never in the shared input data dir.
+  auto ice_table_cache_dir = m_params.get<std::string>("ice_table_cache_dir","NONE");
+  if (ice_table_cache_dir=="NONE") {
+    ice_table_cache_dir = "";
+  }
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals,
+                                     get_comm(), ice_table_cache_dir);
+  P3F::init_ice_table_cells(lookup_tables.ice_table_vals, lookup_tables.ice_table_cells);
   P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
                           lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
                           lookup_tables.dnu_table_vals);
@@ -1,19 +1,27 @@
 #include "physics/p3/atmosphere_microphysics.hpp"
+#include "share/util/scream_timing.hpp"
 
 namespace scream {
 
 void P3Microphysics::run_impl (const double dt)
 {
+  // Level 1 timers, started every step, so their GPTL handles are cached (see TimerHandle)
+  static TimerHandle<1> preproc_timer("EAMxx::P3::preprocess");
+  static TimerHandle<1> main_timer("EAMxx::P3::p3_main");
+  static TimerHandle<1> postproc_timer("EAMxx::P3::postprocess");
+
   // Set the dt for p3 postprocessing
   p3_postproc.m_dt = dt;
 
   // Assign values to local arrays used by P3, these are now stored in p3_loc.
+  preproc_timer.start();
   Kokkos::parallel_for(
     "p3_main_local_vals",
     Kokkos::RangePolicy<>(0,m_num_cols),
     p3_preproc
   ); // Kokkos::parallel_for(p3_main_local_vals)
   Kokkos::fence();
+  preproc_timer.stop();
 
   // Update the variables in the p3 input structures with local values.
 
@@ -28,16 +36,21 @@ void P3Microphysics::run_impl (const double dt)
   get_field_out("micro_vap_liq_exchange").deep_copy(0.0);
   get_field_out("micro_vap_ice_exchange").deep_copy(0.0);
 
+  // NOTE: p3_main fences before returning
+  main_timer.start();
   P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
                history_only, lookup_tables, workspace_mgr, m_num_cols, m_num_levs);
+  main_timer.stop();
 
   // Conduct the post-processing of the p3_main output.
+  postproc_timer.start();
   Kokkos::parallel_for(
     "p3_main_local_vals",
     Kokkos::RangePolicy<>(0,m_num_cols),
     p3_postproc
   ); // Kokkos::parallel_for(p3_main_local_vals)
   Kokkos::fence();
+  postproc_timer.stop();
 }
 
 } // namespace scream
@@ -84,7 +84,7 @@ void Functions<S,D>
   const uview_1d<Spack>& bm_incld,
   const uview_1d<Spack>& qi_tend,
   const uview_1d<Spack>& ni_tend,
-  const view_ice_table& ice_table_vals,
+  const view_ice_table_cells& ice_table_cells,
   Scalar& precip_ice_surf)
 {
   // Get temporary workspaces needed for the ice-sed calculation
@@ -147,10 +147,14 @@ void Functions<S,D>
           TableIce tab;
           lookup_ice(qi_incld(pk), ni_incld(pk), qm_incld(pk), rhop, tab, qi_gt_small);
 
-          const auto table_val_ni_fallspd = apply_table_ice(0, ice_table_vals, tab, qi_gt_small);
-          const auto table_val_qi_fallspd = apply_table_ice(1, ice_table_vals, tab, qi_gt_small);
-          const auto table_val_ni_lammax = apply_table_ice(6, ice_table_vals, tab, qi_gt_small);
-          const auto table_val_ni_lammin = apply_table_ice(7, ice_table_vals, tab, qi_gt_small);
+          constexpr int num_ice_vals = 4;
+          const int ice_idx[num_ice_vals] = {0, 1, 6, 7};
+          Spack ice_vals[num_ice_vals];
+          apply_table_ice(ice_idx, num_ice_vals, ice_table_cells, tab, ice_vals, qi_gt_small);
+          const auto& table_val_ni_fallspd = ice_vals[0];
+          const auto& table_val_qi_fallspd = ice_vals[1];
+          const auto& table_val_ni_lammax  = ice_vals[2];
+          const auto& table_val_ni_lammin  = ice_vals[3];
 
           // impose mean ice size bounds (i.e. apply lambda limiters)
           // note that the Nmax and Nmin are normalized and thus need to be multiplied by existing N
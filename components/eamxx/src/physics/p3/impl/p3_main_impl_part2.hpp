@@ -26,7 +26,7 @@ void Functions<S,D>
   const Scalar& dt,
   const Scalar& inv_dt,
   const view_dnu_table& dnu,
-  const view_ice_table& ice_table_vals,
+  const view_ice_table_cells& ice_table_cells,
   const view_collect_table& collect_table_vals,
   const view_2d_table& revap_table_vals,
   const uview_1d<const Spack>& pres,
@@ -108,18 +108,45 @@ void Functions<S,D>
   hydrometeorsPresent = false;
   team.team_barrier();
 
-  Kokkos::parallel_for(
-    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
-
+  // if relatively dry and no hydrometeors at a level, there is nothing to do there
+  const auto get_skip_all = [&] (const Int& k) {
     //compute mask to identify padded values in packs, which shouldn't be used in calculations
     const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
     const auto range_mask = range_pack < nk;
-      
-    // if relatively dry and no hydrometeors at this level, skip to end of k-loop (i.e. skip this level)
-    const auto skip_all = ( !range_mask ||
+
+    return ( !range_mask ||
         (qc(k)<qsmall && qr(k)<qsmall && qi(k)<qsmall &&
          T_atm(k)<T_zerodegc && qv_supersat_i(k)< -0.05) );
-    
+  };
+
+  // Find the window [kpack_beg,kpack_end) of packs with some work to do. The upper part
+  // of the column is usually dry, so restricting the k-loop to this window lets all the
+  // threads of the team work on levels that actually have microphysics.
+  // The Min/Max reducers start from their identity (the largest/smallest Int), so a
+  // column with no work gives kpack_beg > kpack_end; clamp that to an empty window.
+  Int kpack_beg, kpack_end;
+  Kokkos::parallel_reduce(
+    Kokkos::TeamVectorRange(team, nk_pack), [&] (const Int& k, Int& kmin) {
+    if (!get_skip_all(k).all() && k < kmin) {
+      kmin = k;
+    }
+  }, Kokkos::Min<Int>(kpack_beg));
+  Kokkos::parallel_reduce(
+    Kokkos::TeamVectorRange(team, nk_pack), [&] (const Int& k, Int& kmax) {
+    if (!get_skip_all(k).all() && k+1 > kmax) {
+      kmax = k+1;
+    }
+  }, Kokkos::Max<Int>(kpack_end));
+  if (kpack_beg >= kpack_end) {
+    kpack_beg = kpack_end = 0;
+  }
+
+  Kokkos::parallel_for(
+    Kokkos::TeamVectorRange(team, kpack_beg, kpack_end), [&] (Int k) {
+
+    // if relatively dry and no hydrometeors at this level, skip to end of k-loop (i.e. skip this level)
+    const auto skip_all = get_skip_all(k);
+
     if (skip_all.all()) {
       return; // skip all process rates
     }
@@ -238,13 +265,17 @@ void Functions<S,D>
         lookup_rain(qr_incld(k), nr_incld(k), table_rain, qi_gt_small);
 
         // call to lookup table interpolation subroutines to get process rates
-        table_val_qi_fallspd.set(qi_gt_small, apply_table_ice(1, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_self_collect.set(qi_gt_small, apply_table_ice(2, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qc2qi_collect.set(qi_gt_small, apply_table_ice(3, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qi2qr_melting.set(qi_gt_small, apply_table_ice(4, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_lammax.set(qi_gt_small, apply_table_ice(6, ice_table_vals, table_ice, qi_gt_small));
-        table_val_ni_lammin.set(qi_gt_small, apply_table_ice(7, ice_table_vals, table_ice, qi_gt_small));
-        table_val_qi2qr_vent_melt.set(qi_gt_small, apply_table_ice(9, ice_table_vals, table_ice, qi_gt_small));
+        constexpr int num_ice_vals = 7;
+        const int ice_idx[num_ice_vals] = {1, 2, 3, 4, 6, 7, 9};
+        Spack ice_vals[num_ice_vals];
+        apply_table_ice(ice_idx, num_ice_vals, ice_table_cells, table_ice, ice_vals, qi_gt_small);
+        table_val_qi_fallspd.set(qi_gt_small, ice_vals[0]);
+        table_val_ni_self_collect.set(qi_gt_small, ice_vals[1]);
+        table_val_qc2qi_collect.set(qi_gt_small, ice_vals[2]);
+        table_val_qi2qr_melting.set(qi_gt_small, ice_vals[3]);
+        table_val_ni_lammax.set(qi_gt_small, ice_vals[4]);
+        table_val_ni_lammin.set(qi_gt_small, ice_vals[5]);
+        table_val_qi2qr_vent_melt.set(qi_gt_small, ice_vals[6]);
 
         // ice-rain collection processes
         const auto qr_gt_small = qr_incld(k) >= qsmall && qi_gt_small;
@@ -22,7 +22,7 @@ void Functions<S,D>
   const MemberType& team,
   const Int& nk_pack,
   const view_dnu_table& dnu,
-  const view_ice_table& ice_table_vals,
+  const view_ice_table_cells& ice_table_cells,
   const uview_1d<const Spack>& inv_exner,
   const uview_1d<const Spack>& cld_frac_l,
   const uview_1d<const Spack>& cld_frac_r,
@@ -149,13 +149,17 @@ void Functions<S,D>
       TableIce table_ice;
       lookup_ice(qi_incld, ni_incld, qm_incld, rhop, table_ice, qi_gt_small);
 
-      table_val_qi_fallspd.set(qi_gt_small, apply_table_ice(1,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_eff_radius.set(qi_gt_small, apply_table_ice(5,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ni_lammax.set(qi_gt_small, apply_table_ice(6,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ni_lammin.set(qi_gt_small, apply_table_ice(7,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_reflectivity.set(qi_gt_small, apply_table_ice(8,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_mean_diam.set(qi_gt_small, apply_table_ice(10, ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_bulk_dens.set(qi_gt_small, apply_table_ice(11, ice_table_vals, table_ice, qi_gt_small));
+      constexpr int num_ice_vals = 7;
+      const int ice_idx[num_ice_vals] = {1, 5, 6, 7, 8, 10, 11};
+      Spack ice_vals[num_ice_vals];
+      apply_table_ice(ice_idx, num_ice_vals, ice_table_cells, table_ice, ice_vals, qi_gt_small);
+      table_val_qi_fallspd.set(qi_gt_small, ice_vals[0]);
+      table_val_ice_eff_radius.set(qi_gt_small, ice_vals[1]);
+      table_val_ni_lammax.set(qi_gt_small, ice_vals[2]);
+      table_val_ni_lammin.set(qi_gt_small, ice_vals[3]);
+      table_val_ice_reflectivity.set(qi_gt_small, ice_vals[4]);
+      table_val_ice_mean_diam.set(qi_gt_small, ice_vals[5]);
+      table_val_ice_bulk_dens.set(qi_gt_small, ice_vals[6]);
 
       // impose mean ice size bounds (i.e. apply lambda limiters)
       // note that the Nmax and Nmin are normalized and thus need to be multiplied by existing N
@@ -2,8 +2,9 @@
 #define P3_TABLE_ICE_IMPL_HPP
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
+#include "p3_table_cache.hpp"
 
-#include <fstream>
+#include <exception>
 
 namespace scream {
 namespace p3 {
@@ -17,6 +18,59 @@ template <typename S, typename D>
 void Functions<S,D>
 ::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
 
+  //
+  // read in ice microphysics table
+  //
+
+  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+
+  std::vector<double> ice_data, collect_data;
+  read_p3_ice_tables(filename, P3C::p3_version, ice_data, collect_data);
+
+  init_kokkos_ice_lookup_tables(ice_data, collect_data, ice_table_vals, collect_table_vals);
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const ekat::Comm& comm, const std::string& cache_dir) {
+
+  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+
+  // Only root reads the tables. If that fails, all ranks must error out
+  // together, rather than leaving the others waiting in the broadcast.
+  std::vector<double> ice_data, collect_data;
+  std::exception_ptr err;
+  int ok = 1;
+  if (comm.am_i_root()) {
+    try {
+      read_p3_ice_tables(filename, P3C::p3_version, ice_data, collect_data, cache_dir);
+    } catch (...) {
+      err = std::current_exception();
+      ok = 0;
+    }
+  }
+  comm.broadcast(&ok, 1, comm.root_rank());
+  if (err) {
+    std::rethrow_exception(err);
+  }
+  EKAT_REQUIRE_MSG(ok == 1, "Error! The root rank failed to read the P3 lookup table " << filename);
+
+  if (not comm.am_i_root()) {
+    ice_data.resize(P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size);
+    collect_data.resize(P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size);
+  }
+  comm.broadcast(ice_data.data(), ice_data.size(), comm.root_rank());
+  comm.broadcast(collect_data.data(), collect_data.size(), comm.root_rank());
+
+  init_kokkos_ice_lookup_tables(ice_data, collect_data, ice_table_vals, collect_table_vals);
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(const std::vector<double>& ice_data, const std::vector<double>& collect_data,
+                                view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+
   using DeviceIcetable = typename view_ice_table::non_const_type;
   using DeviceColtable = typename view_collect_table::non_const_type;
 
@@ -26,44 +80,22 @@ void Functions<S,D>
   const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
   const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
 
-  //
-  // read in ice microphysics table into host views
-  //
-
-  std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
-
-  std::ifstream in(filename);
+  EKAT_REQUIRE_MSG(ice_data.size() == ice_table_vals_h.size() &&
+                   collect_data.size() == collect_table_vals_h.size(),
+                   "Error! Wrong size for P3 ice tables data.");
 
-  // read header
-  std::string version, version_val;
-  in >> version >> version_val;
-  EKAT_REQUIRE_MSG(version == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
-  EKAT_REQUIRE_MSG(version_val == P3C::p3_version, "Bad " << filename << ", expected version " << P3C::p3_version << ", but got " << version_val);
-
-  // read tables
-  double dum_s; int dum_i; // dum_s needs to be double to stream correctly
+  int ice_idx = 0, collect_idx = 0;
   for (int jj = 0; jj < P3C::densize; ++jj) {
     for (int ii = 0; ii < P3C::rimsize; ++ii) {
       for (int i = 0; i < P3C::isize; ++i) {
-        in >> dum_i >> dum_i;
-        int j_idx = 0;
-        for (int j = 0; j < 15; ++j) {
-          in >> dum_s;
-          if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
-          }
+        for (int j = 0; j < P3C::ice_table_size; ++j) {
+          ice_table_vals_h(jj, ii, i, j) = ice_data[ice_idx++];
         }
       }
-
       for (int i = 0; i < P3C::isize; ++i) {
         for (int j = 0; j < P3C::rcollsize; ++j) {
-          in >> dum_i >> dum_i;
-          int k_idx = 0;
-          for (int k = 0; k < 6; ++k) {
-            in >> dum_s;
-            if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
-            }
+          for (int k = 0; k < P3C::collect_table_size; ++k) {
+            collect_table_vals_h(jj, ii, i, j, k) = collect_data[collect_idx++];
           }
         }
       }
@@ -77,6 +109,33 @@ void Functions<S,D>
   collect_table_vals = collect_table_vals_d;
 }
 
+template <typename S, typename D>
+void Functions<S,D>
+::init_ice_table_cells(const view_ice_table& ice_table_vals, view_ice_table_cells& ice_table_cells) {
+
+  using DeviceIceCells = typename view_ice_table_cells::non_const_type;
+  using ExeSpace = typename KT::ExeSpace;
+
+  const auto ice_table_cells_d = DeviceIceCells("ice_table_cells");
+
+  // Corner c of cell (jj,ii,i) is (jj+c/4, ii+(c/2)%2, i+c%2)
+  constexpr int ncells = (P3C::densize-1)*(P3C::rimsize-1)*(P3C::isize-1);
+  Kokkos::parallel_for("init_ice_table_cells",
+                       Kokkos::RangePolicy<ExeSpace>(0,ncells*P3C::ice_table_size),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int q  =  idx % P3C::ice_table_size;
+    const int i  = (idx / P3C::ice_table_size) % (P3C::isize-1);
+    const int ii = (idx / (P3C::ice_table_size*(P3C::isize-1))) % (P3C::rimsize-1);
+    const int jj =  idx / (P3C::ice_table_size*(P3C::isize-1)*(P3C::rimsize-1));
+    for (int c = 0; c < 8; ++c) {
+      ice_table_cells_d(jj, ii, i, q, c) = ice_table_vals(jj+c/4, ii+(c/2)%2, i+c%2, q);
+    }
+  });
+  Kokkos::fence();
+
+  ice_table_cells = ice_table_cells_d;
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>
@@ -216,6 +275,53 @@ typename Functions<S,D>::Spack Functions<S,D>
   return proc;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_ice(const int* idx, const int num_idx,
+                  const view_ice_table_cells& ice_table_cells,
+                  const TableIce& tab, Spack* proc,
+                  const Smask& context)
+{
+  if (!context.any()) return;
+
+  // Interpolation weights along the ice mass, rime fraction and density dimensions
+  const auto w1 = tab.dum1 - Spack(tab.dumi)  - 1;
+  const auto w4 = tab.dum4 - Spack(tab.dumii) - 1;
+  const auto w5 = tab.dum5 - Spack(tab.dumjj) - 1;
+
+  // Cell of each pack entry. The corners of all quantities are contiguous, so
+  // they are fetched with a few cache lines, rather than 8 scattered loads per quantity.
+  const Scalar* cell[Spack::n];
+  for (int s = 0; s < Spack::n; ++s) {
+    cell[s] = &ice_table_cells(tab.dumjj[s], tab.dumii[s], tab.dumi[s], 0, 0);
+  }
+
+  for (int n = 0; n < num_idx; ++n) {
+    Spack v[8];
+    for (int s = 0; s < Spack::n; ++s) {
+      const Scalar* corners = cell[s] + 8*idx[n];
+      for (int c = 0; c < 8; ++c) {
+        v[c][s] = corners[c];
+      }
+    }
+
+    // Same operations (and order) as the other apply_table_ice, so results are BFB
+
+    // current density index
+    auto iproc1 = v[0] + w1 * (v[1] - v[0]);
+    auto gproc1 = v[2] + w1 * (v[3] - v[2]);
+    const auto tmp1 = iproc1 + w4 * (gproc1 - iproc1);
+
+    // density index + 1
+    iproc1 = v[4] + w1 * (v[5] - v[4]);
+    gproc1 = v[6] + w1 * (v[7] - v[6]);
+    const auto tmp2 = iproc1 + w4 * (gproc1 - iproc1);
+
+    proc[n] = tmp1 + w5 * (tmp2 - tmp1);
+  }
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 typename Functions<S,D>::Spack Functions<S,D>
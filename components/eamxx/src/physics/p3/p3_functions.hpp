@@ -7,6 +7,10 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <string>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -87,6 +91,11 @@ struct Functions
   // ice lookup table values
   using view_ice_table    = typename KT::template view<const Scalar[P3C::densize][P3C::rimsize][P3C::isize][P3C::ice_table_size]>;
 
+  // ice lookup table values, interleaved by table cell: for each cell (jj,ii,i), the values of
+  // each quantity at the 8 cell corners are contiguous (one cache line for double precision),
+  // and so are the values of all quantities. See init_ice_table_cells.
+  using view_ice_table_cells = typename KT::template view<const Scalar[P3C::densize-1][P3C::rimsize-1][P3C::isize-1][P3C::ice_table_size][8]>;
+
   // ice lookup table values for ice-rain collision/collection
   using view_collect_table = typename KT::template view<const Scalar[P3C::densize][P3C::rimsize][P3C::isize][P3C::rcollsize][P3C::collect_table_size]>;
 
@@ -231,6 +240,8 @@ struct Functions
     view_collect_table collect_table_vals;
     // droplet spectral shape parameter for mass spectra
     view_dnu_table dnu_table_vals;
+    // ice lookup table values, interleaved by table cell
+    view_ice_table_cells ice_table_cells;
   };
 
   // -- Table3 --
@@ -262,6 +273,21 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only the root rank of comm reads the tables, and broadcasts them.
+  // If cache_dir is not empty, the parsed tables are cached there (see p3_table_cache.hpp).
+  static void init_kokkos_ice_lookup_tables(
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const ekat::Comm& comm, const std::string& cache_dir = "");
+
+  // Copy the tables, as read by read_p3_ice_tables (see p3_table_cache.hpp), to device
+  static void init_kokkos_ice_lookup_tables(
+    const std::vector<double>& ice_data, const std::vector<double>& collect_data,
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
+
+  // Call from host to build the interleaved ice table from the ice table values.
+  static void init_ice_table_cells(
+    const view_ice_table& ice_table_vals, view_ice_table_cells& ice_table_cells);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -312,6 +338,15 @@ struct Functions
                                const TableIce& tab,
                                const Smask& context = Smask(true) );
 
+  // Apply TableIce data to the interleaved ice table, for several quantities at once.
+  // On output, proc[n] holds the value of quantity index[n], for n=0,...,num_idx-1.
+  // Results are the same as calling apply_table_ice for each index.
+  KOKKOS_FUNCTION
+  static void apply_table_ice(const int* index, const int num_idx,
+                              const view_ice_table_cells& ice_table_cells,
+                              const TableIce& tab, Spack* proc,
+                              const Smask& context = Smask(true) );
+
   // Interpolates lookup table values for rain/ice collection processes
   KOKKOS_FUNCTION
   static Spack apply_table_coll(const int& index, const view_collect_table& collect_table_vals,
@@ -451,7 +486,7 @@ struct Functions
     const uview_1d<Spack>& bm_incld,
     const uview_1d<Spack>& qi_tend,
     const uview_1d<Spack>& ni_tend,
-    const view_ice_table& ice_table_vals,
+    const view_ice_table_cells& ice_table_cells,
     Scalar& precip_ice_surf);
 
   // homogeneous freezing of cloud and rain
@@ -839,7 +874,7 @@ struct Functions
     const Scalar& dt,
     const Scalar& inv_dt,
     const view_dnu_table& dnu,
-    const view_ice_table& ice_table_vals,
+    const view_ice_table_cells& ice_table_cells,
     const view_collect_table& collect_table_vals,
     const view_2d_table& revap_table_vals,
     const uview_1d<const Spack>& pres,
@@ -914,7 +949,7 @@ struct Functions
     const MemberType& team,
     const Int& nk_pack,
     const view_dnu_table& dnu,
-    const view_ice_table& ice_table_vals,
+    const view_ice_table_cells& ice_table_cells,
     const uview_1d<const Spack>& inv_exner,
     const uview_1d<const Spack>& cld_frac_l,
     const uview_1d<const Spack>& cld_frac_r,
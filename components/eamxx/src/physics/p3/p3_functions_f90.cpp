@@ -980,6 +980,7 @@ const P3GlobalForFortran::Views& P3GlobalForFortran::get()
   if (!P3GlobalForFortran::s_views) {
     P3GlobalForFortran::s_views = std::make_shared<Views>();
     P3F::init_kokkos_ice_lookup_tables(s_views->m_ice_table_vals, s_views->m_collect_table_vals);
+    P3F::init_ice_table_cells(s_views->m_ice_table_vals, s_views->m_ice_table_cells);
     P3F::init_kokkos_tables(s_views->m_vn_table_vals, s_views->m_vm_table_vals,
       s_views->m_revap_table_vals, s_views->m_mu_r_table_vals, s_views->m_dnu);
   }
@@ -1316,7 +1317,7 @@ void ice_sedimentation_f(
     ni_tend_d    (temp_d[14]);
 
   // Call core function from kernel
-  auto ice_table_vals = P3GlobalForFortran::ice_table_vals();
+  auto ice_table_cells = P3GlobalForFortran::ice_table_cells();
   auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, nk_pack);
   ekat::WorkspaceManager<Spack> wsm(rho_d.extent(0), 6, policy);
   Real my_precip_ice_surf = 0;
@@ -1327,7 +1328,7 @@ void ice_sedimentation_f(
       team, wsm.get_workspace(team),
       nk, ktop, kbot, kdir, dt, inv_dt,
       qi_d, qi_incld_d, ni_d, ni_incld_d, qm_d, qm_incld_d, bm_d, bm_incld_d,
-      qi_tend_d, ni_tend_d, ice_table_vals,
+      qi_tend_d, ni_tend_d, ice_table_cells,
       precip_ice_surf_k);
 
   }, my_precip_ice_surf);
@@ -1765,7 +1766,7 @@ void p3_main_part2_f(
 
   // Call core function from kernel
   const auto dnu         = P3GlobalForFortran::dnu();
-  const auto ice_table_vals        = P3GlobalForFortran::ice_table_vals();
+  const auto ice_table_cells       = P3GlobalForFortran::ice_table_cells();
   const auto collect_table_vals     = P3GlobalForFortran::collect_table_vals();
   const auto revap_table_vals = P3GlobalForFortran::revap_table_vals();
   bview_1d bools_d("bools", 1);
@@ -1773,7 +1774,7 @@ void p3_main_part2_f(
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
 
     P3F::p3_main_part2(
-      team, nk_pack, do_predict_nc, do_prescribed_CCN, dt, inv_dt, dnu, ice_table_vals, collect_table_vals, revap_table_vals,
+      team, nk_pack, do_predict_nc, do_prescribed_CCN, dt, inv_dt, dnu, ice_table_cells, collect_table_vals, revap_table_vals,
       pres_d, dpres_d, dz_d, nc_nuceat_tend_d, inv_exner_d, exner_d, inv_cld_frac_l_d,
       inv_cld_frac_i_d, inv_cld_frac_r_d, ni_activated_d, inv_qc_relvar_d, cld_frac_i_d, cld_frac_l_d, cld_frac_r_d,
       qv_prev_d, t_prev_d, t_d, rho_d, inv_rho_d, qv_sat_l_d, qv_sat_i_d, qv_supersat_i_d, rhofacr_d, rhofaci_d, acn_d,
@@ -1887,11 +1888,11 @@ void p3_main_part3_f(
 
   // Call core function from kernel
   const auto dnu            = P3GlobalForFortran::dnu();
-  const auto ice_table_vals = P3GlobalForFortran::ice_table_vals();
+  const auto ice_table_cells = P3GlobalForFortran::ice_table_cells();
   auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, nk_pack);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    P3F::p3_main_part3(team, nk_pack, dnu, ice_table_vals,
+    P3F::p3_main_part3(team, nk_pack, dnu, ice_table_cells,
                        inv_exner_d, cld_frac_l_d, cld_frac_r_d, cld_frac_i_d, rho_d, inv_rho_d,
                        rhofaci_d, qv_d, th_atm_d, qc_d, nc_d, qr_d, nr_d,
                        qi_d, ni_d, qm_d, bm_d, latent_heat_vapor_d,
@@ -1937,6 +1938,7 @@ Int p3_main_f(
   using view_1d_table      = typename P3F::view_1d_table;
   using view_2d_table      = typename P3F::view_2d_table;
   using view_ice_table     = typename P3F::view_ice_table;
+  using view_ice_table_cells = typename P3F::view_ice_table_cells;
   using view_collect_table = typename P3F::view_collect_table;
   using view_dnu_table     = typename P3F::view_dnu_table;
 
@@ -2052,13 +2054,15 @@ Int p3_main_f(
   view_1d_table mu_r_table_vals;
   view_2d_table vn_table_vals, vm_table_vals, revap_table_vals;
   view_ice_table ice_table_vals;
+  view_ice_table_cells ice_table_cells;
   view_collect_table collect_table_vals;
   view_dnu_table dnu_table_vals;
   P3F::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
+  P3F::init_ice_table_cells(ice_table_vals, ice_table_cells);
   P3F::init_kokkos_tables(vn_table_vals, vm_table_vals, revap_table_vals, mu_r_table_vals, dnu_table_vals);
 
   P3F::P3LookupTables lookup_tables{mu_r_table_vals, vn_table_vals, vm_table_vals, revap_table_vals,
-                                    ice_table_vals, collect_table_vals, dnu_table_vals};
+                                    ice_table_vals, collect_table_vals, dnu_table_vals, ice_table_cells};
 
   // Create local workspace
   const Int nk_pack = ekat::npack<Spack>(nk);
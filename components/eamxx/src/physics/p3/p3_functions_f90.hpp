@@ -28,6 +28,7 @@ struct P3GlobalForFortran
   using view_1d_table = typename P3F::view_1d_table;
   using view_2d_table = typename P3F::view_2d_table;
   using view_ice_table = typename P3F::view_ice_table;
+  using view_ice_table_cells = typename P3F::view_ice_table_cells;
   using view_collect_table = typename P3F::view_collect_table;
   using view_dnu_table = typename P3F::view_dnu_table;
 
@@ -39,6 +40,7 @@ struct P3GlobalForFortran
   static const view_2d_table& vm_table_vals()     { return get().m_vm_table_vals; }
   static const view_2d_table& revap_table_vals()  { return get().m_revap_table_vals; }
   static const view_ice_table& ice_table_vals()       { return get().m_ice_table_vals; }
+  static const view_ice_table_cells& ice_table_cells() { return get().m_ice_table_cells; }
   static const view_collect_table& collect_table_vals() { return get().m_collect_table_vals; }
   static const view_dnu_table& dnu()         { return get().m_dnu; }
 
@@ -52,6 +54,7 @@ struct P3GlobalForFortran
     view_1d_table m_mu_r_table_vals;
     view_2d_table m_vn_table_vals, m_vm_table_vals, m_revap_table_vals;
     view_ice_table m_ice_table_vals;
+    view_ice_table_cells m_ice_table_cells;
     view_collect_table m_collect_table_vals;
     view_dnu_table m_dnu;
   };
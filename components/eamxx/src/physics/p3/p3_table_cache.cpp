@@ -0,0 +1,241 @@
+#include "physics/p3/p3_table_cache.hpp"
+#include "physics/p3/p3_functions.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace scream {
+namespace p3 {
+
+namespace {
+
+using P3C = Functions<Real,DefaultDevice>::P3C;
+
+constexpr int ice_size     = P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+constexpr int collect_size = P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
+
+// Bump this whenever the cache layout changes
+constexpr std::int32_t cache_format_version = 2;
+
+struct CacheHeader {
+  char          magic[8];
+  std::int32_t  format_version;
+  std::int32_t  dims[6];
+  char          table_version[16];
+  std::int32_t  reserved;
+  // Size and modification time of the text table the cache was generated from
+  std::int64_t  table_size;
+  std::int64_t  table_mtime;
+  std::uint64_t checksum;
+};
+
+const char cache_magic[8] = {'P','3','T','A','B','L','E','S'};
+
+// FNV-1a hash of the table data
+std::uint64_t checksum (const double* ice_data, const double* collect_data) {
+  std::uint64_t h = 14695981039346656037ULL;
+  auto hash = [&](const double* data, const int n) {
+    const auto bytes = reinterpret_cast<const unsigned char*>(data);
+    for (std::size_t i=0; i<n*sizeof(double); ++i) {
+      h ^= bytes[i];
+      h *= 1099511628211ULL;
+    }
+  };
+  hash(ice_data,ice_size);
+  hash(collect_data,collect_size);
+  return h;
+}
+
+// Fills the header with everything but the checksum. Returns false if the
+// text table cannot be stat-ed.
+bool make_header (const std::string& table_filename, const std::string& version,
+                  CacheHeader& header) {
+  struct stat st;
+  if (stat(table_filename.c_str(),&st)!=0) {
+    return false;
+  }
+
+  std::memset(&header,0,sizeof(CacheHeader));
+  std::memcpy(header.magic,cache_magic,sizeof(cache_magic));
+  header.format_version = cache_format_version;
+  header.dims[0] = P3C::densize;
+  header.dims[1] = P3C::rimsize;
+  header.dims[2] = P3C::isize;
+  header.dims[3] = P3C::ice_table_size;
+  header.dims[4] = P3C::rcollsize;
+  header.dims[5] = P3C::collect_table_size;
+  std::strncpy(header.table_version,version.c_str(),sizeof(header.table_version)-1);
+  header.table_size  = st.st_size;
+  header.table_mtime = st.st_mtime;
+  return true;
+}
+
+} // anonymous namespace
+
+void read_p3_ice_tables_text (const std::string& filename, const std::string& version,
+                              std::vector<double>& ice_data, std::vector<double>& collect_data)
+{
+  std::ifstream in(filename);
+  EKAT_REQUIRE_MSG(in.good(), "Error! Could not open P3 lookup table " << filename);
+
+  // read header
+  std::string version_str, version_val;
+  in >> version_str >> version_val;
+  EKAT_REQUIRE_MSG(version_str == "VERSION", "Bad " << filename << ", expected VERSION X.Y.Z header");
+  EKAT_REQUIRE_MSG(version_val == version, "Bad " << filename << ", expected version " << version << ", but got " << version_val);
+
+  ice_data.resize(ice_size);
+  collect_data.resize(collect_size);
+
+  // read tables
+  double dum_s; int dum_i; // dum_s needs to be double to stream correctly
+  int ice_idx = 0, collect_idx = 0;
+  for (int jj = 0; jj < P3C::densize; ++jj) {
+    for (int ii = 0; ii < P3C::rimsize; ++ii) {
+      for (int i = 0; i < P3C::isize; ++i) {
+        in >> dum_i >> dum_i;
+        for (int j = 0; j < 15; ++j) {
+          in >> dum_s;
+          if (j > 1 && j != 10) {
+            ice_data[ice_idx++] = dum_s;
+          }
+        }
+      }
+
+      for (int i = 0; i < P3C::isize; ++i) {
+        for (int j = 0; j < P3C::rcollsize; ++j) {
+          in >> dum_i >> dum_i;
+          for (int k = 0; k < 6; ++k) {
+            in >> dum_s;
+            if (k == 3 || k == 4) {
+              collect_data[collect_idx++] = std::log10(dum_s);
+            }
+          }
+        }
+      }
+    }
+  }
+  EKAT_REQUIRE_MSG(not in.fail(), "Error! Failed to parse P3 lookup table " << filename);
+}
+
+bool read_p3_ice_tables_cache (const std::string& filename, const std::string& table_filename,
+                               const std::string& version,
+                               std::vector<double>& ice_data, std::vector<double>& collect_data)
+{
+  CacheHeader expected;
+  if (not make_header(table_filename,version,expected)) {
+    return false;
+  }
+
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd<0) {
+    return false;
+  }
+
+  const std::size_t expected_size = sizeof(CacheHeader) + (ice_size+collect_size)*sizeof(double);
+  struct stat st;
+  if (fstat(fd,&st)!=0 || static_cast<std::size_t>(st.st_size)!=expected_size) {
+    close(fd);
+    return false;
+  }
+
+  void* addr = mmap(nullptr, expected_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr==MAP_FAILED) {
+    return false;
+  }
+
+  const auto bytes = static_cast<const char*>(addr);
+  CacheHeader header;
+  std::memcpy(&header,bytes,sizeof(CacheHeader));
+
+  // Check everything but the checksum first
+  expected.checksum = header.checksum;
+  bool ok = std::memcmp(&header,&expected,sizeof(CacheHeader))==0;
+  if (ok) {
+    ice_data.resize(ice_size);
+    collect_data.resize(collect_size);
+    std::memcpy(ice_data.data(), bytes+sizeof(CacheHeader), ice_size*sizeof(double));
+    std::memcpy(collect_data.data(), bytes+sizeof(CacheHeader)+ice_size*sizeof(double),
+                collect_size*sizeof(double));
+    ok = checksum(ice_data.data(),collect_data.data())==header.checksum;
+  }
+
+  munmap(addr,expected_size);
+  return ok;
+}
+
+bool write_p3_ice_tables_cache (const std::string& filename, const std::string& table_filename,
+                                const std::string& version,
+                                const std::vector<double>& ice_data,
+                                const std::vector<double>& collect_data)
+{
+  EKAT_REQUIRE_MSG(static_cast<int>(ice_data.size())==ice_size &&
+                   static_cast<int>(collect_data.size())==collect_size,
+      "Error! Wrong size for P3 ice tables data.\n");
+
+  CacheHeader header;
+  if (not make_header(table_filename,version,header)) {
+    return false;
+  }
+  header.checksum = checksum(ice_data.data(),collect_data.data());
+
+  // Write to a temporary file first, and rename it at the end, so that other
+  // processes never see a partially written cache
+  const std::string tmp_filename = filename + ".tmp." + std::to_string(getpid());
+  FILE* f = std::fopen(tmp_filename.c_str(),"wb");
+  if (f==nullptr) {
+    return false;
+  }
+  bool ok = std::fwrite(&header,sizeof(CacheHeader),1,f)==1 &&
+            std::fwrite(ice_data.data(),sizeof(double),ice_size,f)==static_cast<std::size_t>(ice_size) &&
+            std::fwrite(collect_data.data(),sizeof(double),collect_size,f)==static_cast<std::size_t>(collect_size);
+  ok = (std::fclose(f)==0) && ok;
+  ok = ok && std::rename(tmp_filename.c_str(),filename.c_str())==0;
+  if (not ok) {
+    std::remove(tmp_filename.c_str());
+  }
+  return ok;
+}
+
+std::string p3_ice_tables_cache_name (const std::string& table_filename,
+                                      const std::string& cache_dir)
+{
+  const auto pos = table_filename.find_last_of('/');
+  const auto basename = pos==std::string::npos ? table_filename : table_filename.substr(pos+1);
+  return cache_dir + "/" + basename + ".bin";
+}
+
+void read_p3_ice_tables (const std::string& table_filename, const std::string& version,
+                         std::vector<double>& ice_data, std::vector<double>& collect_data,
+                         const std::string& cache_dir)
+{
+  if (cache_dir=="") {
+    read_p3_ice_tables_text(table_filename,version,ice_data,collect_data);
+    return;
+  }
+
+  const auto cache_filename = p3_ice_tables_cache_name(table_filename,cache_dir);
+  if (read_p3_ice_tables_cache(cache_filename,table_filename,version,ice_data,collect_data)) {
+    return;
+  }
+
+  read_p3_ice_tables_text(table_filename,version,ice_data,collect_data);
+
+  // If the cache cannot be written (e.g., read-only cache directory), we simply
+  // parse the text table again next time.
+  write_p3_ice_tables_cache(cache_filename,table_filename,version,ice_data,collect_data);
+}
+
+} // namespace p3
+} // namespace scream
@@ -0,0 +1,64 @@
+#ifndef P3_TABLE_CACHE_HPP
+#define P3_TABLE_CACHE_HPP
+
+#include <string>
+#include <vector>
+
+namespace scream {
+namespace p3 {
+
+/*
+ * Binary cache of the P3 ice lookup tables.
+ *
+ * Parsing the text ice lookup table is slow. If a cache directory is given,
+ * the first time the text table is parsed, the parsed values are written to a
+ * binary cache file in that directory (e.g., the case run directory), which is
+ * then memory-mapped on later runs. The cache is never written next to the text
+ * table, since the input data directory is typically shared by many users.
+ *
+ * The cache stores the values in double precision, exactly as parsed (before
+ * any conversion to the model precision), so that the tables are the same
+ * whether they come from the cache or from the text file. The cache starts
+ * with a header holding a magic number, the cache format version, the P3 table
+ * version, the table sizes, the size and modification time of the text table
+ * it was generated from, and a checksum of the data. If any of these does not
+ * match, the cache is ignored (and rewritten). In particular, a cache becomes
+ * stale as soon as the text table is replaced.
+ *
+ * The tables are stored as flattened arrays, with the last index fastest:
+ *  - ice_data:     [densize][rimsize][isize][ice_table_size]
+ *  - collect_data: [densize][rimsize][isize][rcollsize][collect_table_size]
+ */
+
+// Parse the text ice lookup table
+void read_p3_ice_tables_text (const std::string& filename, const std::string& version,
+                              std::vector<double>& ice_data, std::vector<double>& collect_data);
+
+// Read the binary cache of the text table table_filename. Returns false if the
+// cache is missing or stale (in which case ice_data and collect_data are unspecified).
+bool read_p3_ice_tables_cache (const std::string& filename, const std::string& table_filename,
+                               const std::string& version,
+                               std::vector<double>& ice_data, std::vector<double>& collect_data);
+
+// Write the binary cache of the text table table_filename. Returns false if the
+// file could not be written (e.g., the cache directory is read-only).
+bool write_p3_ice_tables_cache (const std::string& filename, const std::string& table_filename,
+                                const std::string& version,
+                                const std::vector<double>& ice_data,
+                                const std::vector<double>& collect_data);
+
+// Read the ice tables of the given version. If cache_dir is empty, always parse
+// the text table. Otherwise, read them from the cache in cache_dir if possible,
+// and from the text table otherwise (in which case the cache is written).
+void read_p3_ice_tables (const std::string& table_filename, const std::string& version,
+                         std::vector<double>& ice_data, std::vector<double>& collect_data,
+                         const std::string& cache_dir = "");
+
+// The name of the cache file of a text table, in the given cache directory
+std::string p3_ice_tables_cache_name (const std::string& table_filename,
+                                      const std::string& cache_dir);
+
+} // namespace p3
+} // namespace scream
+
+#endif // P3_TABLE_CACHE_HPP
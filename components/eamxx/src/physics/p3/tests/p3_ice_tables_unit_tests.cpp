@@ -5,6 +5,7 @@
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
 #include "p3_functions.hpp"
 #include "p3_functions_f90.hpp"
+#include "p3_table_cache.hpp"
 
 #include "p3_unit_tests_common.hpp"
 
@@ -12,6 +13,9 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
 
 namespace scream {
 namespace p3 {
@@ -96,6 +100,67 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     table = view_device;
   }
 
+  static void test_table_cache()
+  {
+    using P3C = typename Functions::P3C;
+
+    // Work on a local copy of the text table, so that we can modify it. Tests with
+    // different thread counts may run concurrently, so make the file name unique.
+    const std::string data_table = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
+    const std::string table = "p3_ice_tables_unit_tests_table." + std::to_string(getpid()) + ".dat";
+    {
+      std::ifstream src(data_table, std::ios::binary);
+      std::ofstream dst(table, std::ios::binary);
+      dst << src.rdbuf();
+    }
+
+    std::vector<double> ice_text, collect_text;
+    read_p3_ice_tables_text(table, P3C::p3_version, ice_text, collect_text);
+
+    // The cache goes in the requested directory, not next to the table
+    REQUIRE(p3_ice_tables_cache_name(data_table, "cache_dir") ==
+            "cache_dir/p3_lookup_table_1.dat-v" + std::string(P3C::p3_version) + ".bin");
+    const std::string cache = p3_ice_tables_cache_name(table, ".");
+
+    // The cache must give back exactly the parsed values
+    REQUIRE(write_p3_ice_tables_cache(cache, table, P3C::p3_version, ice_text, collect_text));
+    std::vector<double> ice_cache, collect_cache;
+    REQUIRE(read_p3_ice_tables_cache(cache, table, P3C::p3_version, ice_cache, collect_cache));
+    REQUIRE(ice_cache == ice_text);
+    REQUIRE(collect_cache == collect_text);
+
+    // Same for the top-level reader, both when it writes the cache and when it reads it
+    std::remove(cache.c_str());
+    for (int pass=0; pass<2; ++pass) {
+      read_p3_ice_tables(table, P3C::p3_version, ice_cache, collect_cache, ".");
+      REQUIRE(ice_cache == ice_text);
+      REQUIRE(collect_cache == collect_text);
+    }
+
+    // A cache for another table version must be rejected
+    REQUIRE(not read_p3_ice_tables_cache(cache, table, "0.0.0", ice_cache, collect_cache));
+
+    // A cache of a text table that has since been modified must be rejected
+    {
+      std::ofstream f(table, std::ios::app);
+      f << "\n";
+    }
+    REQUIRE(not read_p3_ice_tables_cache(cache, table, P3C::p3_version, ice_cache, collect_cache));
+    REQUIRE(write_p3_ice_tables_cache(cache, table, P3C::p3_version, ice_text, collect_text));
+
+    // A corrupted cache must be rejected
+    {
+      std::fstream f(cache, std::ios::in | std::ios::out | std::ios::binary);
+      f.seekp(-static_cast<std::streamoff>(sizeof(double)), std::ios::end);
+      const double garbage = -1;
+      f.write(reinterpret_cast<const char*>(&garbage), sizeof(double));
+    }
+    REQUIRE(not read_p3_ice_tables_cache(cache, table, P3C::p3_version, ice_cache, collect_cache));
+
+    std::remove(cache.c_str());
+    std::remove(table.c_str());
+  }
+
   static void run_bfb()
   {
     using KTH = KokkosTypes<HostDevice>;
@@ -105,6 +170,9 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     view_collect_table collect_table_vals;
     Functions::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
 
+    view_ice_table_cells ice_table_cells;
+    Functions::init_ice_table_cells(ice_table_vals, ice_table_cells);
+
     constexpr Scalar qsmall = C::QSMALL;
 
     // Load some lookup inputs, need at least one per pack value
@@ -220,6 +288,7 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     // Run the lookup from a kernel and copy results back to host
     view_2d<Int>  int_results("int results", 5, max_pack_size);
     view_2d<Real> real_results("real results", 7, max_pack_size);
+    view_1d<Int>  cells_mismatch("cells mismatch", max_pack_size);
     Kokkos::parallel_for(num_test_itrs, KOKKOS_LAMBDA(const Int& i) {
       const Int offset = i * Spack::n;
 
@@ -242,6 +311,23 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
       Spack ice_result = Functions::apply_table_ice(access_table_index-1, ice_table_vals, ti, qiti_gt_small);
       Spack rain_result = Functions::apply_table_coll(access_table_index-1, collect_table_vals, ti, tr, qiti_gt_small);
 
+      // The interleaved ice table must give the same values, for all quantities
+      constexpr Int nq = Functions::P3C::ice_table_size;
+      int all_idx[nq];
+      for (Int q = 0; q < nq; ++q) {
+        all_idx[q] = q;
+      }
+      Spack cells_results[nq];
+      Functions::apply_table_ice(all_idx, nq, ice_table_cells, ti, cells_results, qiti_gt_small);
+      for (Int q = 0; q < nq; ++q) {
+        const Spack single_result = Functions::apply_table_ice(q, ice_table_vals, ti, qiti_gt_small);
+        for (Int s = 0, vs = offset; s < Spack::n; ++s, ++vs) {
+          if (qiti_gt_small[s] && cells_results[q][s] != single_result[s]) {
+            ++cells_mismatch(vs);
+          }
+        }
+      }
+
       for (Int s = 0, vs = offset; s < Spack::n; ++s, ++vs) {
         int_results(0, vs) = ti.dumi[s];
         int_results(1, vs) = ti.dumjj[s];
@@ -268,6 +354,8 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     auto real_results_mirror = Kokkos::create_mirror_view(real_results);
     Kokkos::deep_copy(int_results_mirror, int_results);
     Kokkos::deep_copy(real_results_mirror, real_results);
+    auto cells_mismatch_mirror = Kokkos::create_mirror_view(cells_mismatch);
+    Kokkos::deep_copy(cells_mismatch_mirror, cells_mismatch);
 
     // Validate results
     if (SCREAM_BFB_TESTING) {
@@ -290,6 +378,8 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
         REQUIRE(real_results_mirror(5, s) == altd[s].proc);
 
         REQUIRE(real_results_mirror(6, s) == altcd[s].proc);
+
+        REQUIRE(cells_mismatch_mirror(s) == 0);
       }
     }
   }
@@ -346,6 +436,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   using TTI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestTableIce;
 
   TTI::test_read_lookup_tables_bfb();
+  TTI::test_table_cache();
   TTI::run_phys();
   TTI::run_bfb();
 }
@@ -41,6 +41,7 @@ struct UnitWrap {
 
     using Functions          = scream::p3::Functions<Real, Device>;
     using view_ice_table     = typename Functions::view_ice_table;
+    using view_ice_table_cells = typename Functions::view_ice_table_cells;
     using view_collect_table = typename Functions::view_collect_table;
     using view_1d_table      = typename Functions::view_1d_table;
     using view_2d_table      = typename Functions::view_2d_table;
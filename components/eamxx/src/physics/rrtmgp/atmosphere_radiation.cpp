@@ -65,6 +65,8 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   for (int i=0; i<m_num_col_chunks; ++i) {
     m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
   }
+  m_col_perm   = view_1d_int("col_perm",m_ncol);
+  m_col_perm_h = Kokkos::create_mirror_view(m_col_perm);
   this->log(LogLevel::debug,
             "[RRTMGP::set_grids] Col chunking stats:\n"
             "  - Chunk size: " + std::to_string(m_col_chunk_size) + "\n"
@@ -155,6 +157,26 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   add_field<Computed>("sfc_flux_sw_net" , scalar2d_layout, Wm2, grid_name, "RESTART");
   add_field<Computed>("sfc_flux_lw_dn"  , scalar2d_layout, Wm2, grid_name, "RESTART");
 
+  // Adaptive radiation: the state used to decide which columns to recompute
+  // must be restarted, for restarted runs to skip the same columns.
+  m_adaptive_rad = m_params.get<bool>("adaptive_radiation",false);
+  if (m_adaptive_rad) {
+    m_adaptive_rad_tols.T          = m_params.get<double>("adaptive_rad_T_tol",1.0);
+    m_adaptive_rad_tols.cldfrac    = m_params.get<double>("adaptive_rad_cldfrac_tol",0.05);
+    m_adaptive_rad_tols.water_path = m_params.get<double>("adaptive_rad_water_path_tol",1e-3);
+    m_adaptive_rad_tols.albedo     = m_params.get<double>("adaptive_rad_albedo_tol",0.01);
+    m_adaptive_rad_tols.max_skip   = m_params.get<int>("adaptive_rad_max_skip",4);
+
+    FieldLayout wp_layout  { {COL,CMP}, {m_ncol,2} };
+    FieldLayout alb_layout { {COL,CMP}, {m_ncol,4} };
+    add_field<Computed>("rad_adaptive_num_skips"     , scalar2d_layout    , nondim, grid_name, "RESTART");
+    add_field<Computed>("rad_adaptive_was_sunlit"    , scalar2d_layout    , nondim, grid_name, "RESTART");
+    add_field<Computed>("rad_adaptive_ref_T_mid"     , scalar3d_layout_mid, K     , grid_name, "RESTART");
+    add_field<Computed>("rad_adaptive_ref_cldfrac"   , scalar3d_layout_mid, nondim, grid_name, "RESTART");
+    add_field<Computed>("rad_adaptive_ref_water_path", wp_layout          , kg/m2 , grid_name, "RESTART");
+    add_field<Computed>("rad_adaptive_ref_sfc_alb"   , alb_layout         , nondim, grid_name, "RESTART");
+  }
+
   // Boundary flux fields for energy and mass conservation checks
   if (has_column_conservation_check()) {
     add_field<Computed>("vapor_flux", scalar2d_layout, kg/m2/s, grid_name);
@@ -168,6 +190,7 @@ size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
 {
   const size_t interface_request =
     Buffer::num_1d_ncol*m_col_chunk_size +
+    Buffer::num_1d_ncol_all*m_ncol +
     Buffer::num_2d_nlay*m_col_chunk_size*m_nlay +
     Buffer::num_2d_nlay_p1*m_col_chunk_size*(m_nlay+1) +
     Buffer::num_2d_nswbands*m_col_chunk_size*m_nswbands +
@@ -207,7 +230,7 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   mem += m_buffer.sfc_flux_dif_vis.totElems();
   m_buffer.sfc_flux_dif_nir = decltype(m_buffer.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, m_col_chunk_size);
   mem += m_buffer.sfc_flux_dif_nir.totElems();
-  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunk_size);
+  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_ncol);
   mem += m_buffer.cosine_zenith.size();
 
   // 2d arrays
@@ -300,7 +323,7 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
 } // RRTMGPRadiation::init_buffers
 
-void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
+void RRTMGPRadiation::initialize_impl(const RunType run_type) {
   using PC = scream::physics::Constants<Real>;
 
   // Determine rad timestep, specified as number of atm steps
@@ -330,6 +353,21 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   // Whether or not to do MCICA subcolumn sampling
   m_do_subcol_sampling = m_params.get<bool>("do_subcol_sampling",true);
 
+  // Adaptive radiation state. In a restarted run, it was read from the restart file.
+  m_rad_col_updated   = view_1d_int("rad_col_updated",m_ncol);
+  m_rad_col_updated_h = Kokkos::create_mirror_view(m_rad_col_updated);
+  if (m_adaptive_rad) {
+    m_adaptive_rad_inited = run_type==RunType::Restarted;
+    auto& state = m_adaptive_rad_state;
+    state.num_skips      = get_field_out("rad_adaptive_num_skips").get_view<Real*>();
+    state.was_sunlit     = get_field_out("rad_adaptive_was_sunlit").get_view<Real*>();
+    state.ref_T_mid      = get_field_out("rad_adaptive_ref_T_mid").get_view<Real**>();
+    state.ref_cldfrac    = get_field_out("rad_adaptive_ref_cldfrac").get_view<Real**>();
+    state.ref_water_path = get_field_out("rad_adaptive_ref_water_path").get_view<Real**>();
+    state.ref_sfc_alb    = get_field_out("rad_adaptive_ref_sfc_alb").get_view<Real**>();
+    m_rad_sfc_alb = view_2d_real("rad_sfc_alb",m_ncol,4);
+  }
+
   // Initialize yakl
   yakl_init();
 
@@ -474,12 +512,79 @@ void RRTMGPRadiation::run_impl (const double dt) {
     shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
                      obliqr, &delta, &eccf);
 
-    // Loop over each chunk of columns
-    for (int ic=0; ic<m_num_col_chunks; ++ic) {
+    // Determine the cosine zenith angle for all columns, and sort the columns so that
+    // the sunlit ones come first (keeping their relative order). Chunks are then built
+    // on top of this permutation, so that SW (which only runs on sunlit columns) works
+    // on full chunks, and chunks with no sunlit columns skip it altogether.
+    // NOTE: Since we are bridging to F90 arrays this must be done on HOST and then
+    //       deep copied to a device view.
+    auto d_mu0 = m_buffer.cosine_zenith;
+    int num_day_cols = 0;
+    int num_rad_cols = 0;
+    {
+      auto h_mu0 = Kokkos::create_mirror_view(d_mu0);
+      if (m_fixed_solar_zenith_angle > 0) {
+        for (int i=0; i<m_ncol; i++) {
+          h_mu0(i) = m_fixed_solar_zenith_angle;
+        }
+      } else {
+        // Now use solar declination to calculate zenith angle for all points
+        for (int i=0;i<m_ncol;i++) {
+          double lat = h_lat(i)*PC::Pi/180.0;  // Convert lat/lon to radians
+          double lon = h_lon(i)*PC::Pi/180.0;
+          h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
+        }
+      }
+      Kokkos::deep_copy(d_mu0,h_mu0);
+
+      // Select the columns whose fluxes need to be recomputed (all of them, unless
+      // adaptive radiation is on)
+      if (m_adaptive_rad) {
+        select_adaptive_rad_columns();
+      } else {
+        Kokkos::deep_copy(m_rad_col_updated,1);
+      }
+      Kokkos::deep_copy(m_rad_col_updated_h,m_rad_col_updated);
+
+      // Selected sunlit columns first, then selected night columns, then the others.
+      for (int i=0; i<m_ncol; ++i) {
+        if (m_rad_col_updated_h(i) and h_mu0(i) > 0) {
+          m_col_perm_h(num_rad_cols++) = i;
+        }
+      }
+      num_day_cols = num_rad_cols;
+      for (int i=0; i<m_ncol; ++i) {
+        if (m_rad_col_updated_h(i) and not (h_mu0(i) > 0)) {
+          m_col_perm_h(num_rad_cols++) = i;
+        }
+      }
+      for (int i=0, iskip=num_rad_cols; i<m_ncol; ++i) {
+        if (not m_rad_col_updated_h(i)) {
+          m_col_perm_h(iskip++) = i;
+        }
+      }
+      Kokkos::deep_copy(m_col_perm,m_col_perm_h);
+    }
+    this->log(LogLevel::debug,
+              "[RRTMGP::run_impl] Sunlit (SW) columns: " + std::to_string(num_day_cols) +
+              " out of " + std::to_string(m_ncol) + "\n");
+    if (m_adaptive_rad) {
+      this->log(LogLevel::debug,
+                "[RRTMGP::run_impl] Recomputed columns: " + std::to_string(num_rad_cols) +
+                " out of " + std::to_string(m_ncol) + "\n");
+    }
+    const auto col_perm = m_col_perm;
+
+    // Loop over each chunk of columns. Only the first num_rad_cols columns of the
+    // permutation are recomputed, so the last chunks may be partial, or not needed at all.
+    const int num_rad_chunks = (num_rad_cols + m_col_chunk_size - 1) / m_col_chunk_size;
+    for (int ic=0; ic<num_rad_chunks; ++ic) {
       const int beg  = m_col_chunk_beg[ic];
-      const int ncol = m_col_chunk_beg[ic+1] - beg;
+      const int ncol = std::min(m_col_chunk_beg[ic+1],num_rad_cols) - beg;
+      const int nday = std::max(0,std::min(num_day_cols-beg,ncol));
       this->log(LogLevel::debug,
-                "[RRTMGP::run_impl] Col chunk beg,end: " + std::to_string(beg) + ", " + std::to_string(beg+ncol) + "\n");
+                "[RRTMGP::run_impl] Col chunk beg,end: " + std::to_string(beg) + ", " + std::to_string(beg+ncol) +
+                " (sunlit: " + std::to_string(nday) + ")\n");
 
 
       // Create YAKL arrays. RRTMGP expects YAKL arrays with styleFortran, i.e., data has ncol
@@ -544,25 +649,6 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
       // Copy data from the FieldManager to the YAKL arrays
       {
-        // Determine the cosine zenith angle
-        // NOTE: Since we are bridging to F90 arrays this must be done on HOST and then
-        //       deep copied to a device view.
-        auto d_mu0 = m_buffer.cosine_zenith;
-        auto h_mu0 = Kokkos::create_mirror_view(d_mu0);
-        if (m_fixed_solar_zenith_angle > 0) {
-          for (int i=0; i<ncol; i++) {
-            h_mu0(i) = m_fixed_solar_zenith_angle;
-          }
-        } else {
-          // Now use solar declination to calculate zenith angle for all points
-          for (int i=0;i<ncol;i++) {
-            double lat = h_lat(i+beg)*PC::Pi/180.0;  // Convert lat/lon to radians
-            double lon = h_lon(i+beg)*PC::Pi/180.0;
-            h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, m_rad_freq_in_steps * dt);
-          }
-        }
-        Kokkos::deep_copy(d_mu0,h_mu0);
-
         // dz and T_int will need to be computed
         view_2d_real d_tint("T_int", ncol, m_nlay+1);
         view_2d_real d_dz  ("dz",    ncol, m_nlay);
@@ -570,7 +656,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i+beg;
+          const int icol = col_perm(i+beg);
 
           // Calculate dz
           const auto pseudo_density = ekat::subview(d_pdel, icol);
@@ -602,7 +688,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
           }
           team.team_barrier();
 
-          mu0(i+1) = d_mu0(i);
+          mu0(i+1) = d_mu0(icol);
           sfc_alb_dir_vis(i+1) = d_sfc_alb_dir_vis(icol);
           sfc_alb_dir_nir(i+1) = d_sfc_alb_dir_nir(icol);
           sfc_alb_dif_vis(i+1) = d_sfc_alb_dif_vis(icol);
@@ -660,7 +746,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
           const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
           Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
             const int i = team.league_rank();
-            const int icol = i + beg;
+            const int icol = col_perm(i+beg);
             Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
               d_vmr(icol,k) = PF::calculate_vmr_from_mmr(gas_mol_weights[igas],d_qv(icol,k),d_qv(icol,k));
             });
@@ -695,7 +781,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i + beg;
+          const int icol = col_perm(i+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             tmp2d(i+1,k+1) = d_vmr(icol,k); // Note that for YAKL arrays i and k start with index 1
           });
@@ -723,7 +809,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i + beg;
+          const int icol = col_perm(i+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             if (d_cldfrac_tot(icol,k) > 0) {
               cldfrac_tot(i+1,k+1) = 1;
@@ -736,7 +822,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
-          const int icol = i + beg;
+          const int icol = col_perm(i+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             cldfrac_tot(i+1,k+1) = d_cldfrac_tot(icol,k);
           });
@@ -798,7 +884,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
-          const int icol = idx+beg;
+          const int icol = col_perm(idx+beg);
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
             // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
             // Note that for YAKL arrays i and k start with index 1
@@ -848,7 +934,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
       Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
         const int i = team.league_rank();
-        const int icol = i + beg;
+        const int icol = col_perm(i+beg);
         d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir(i+1);
         d_sfc_flux_dir_vis(icol) = sfc_flux_dir_vis(i+1);
         d_sfc_flux_dif_nir(icol) = sfc_flux_dif_nir(i+1);
@@ -885,11 +971,14 @@ void RRTMGPRadiation::run_impl (const double dt) {
   // across timesteps to conserve energy.
   const int ncols = m_ncol;
   const int nlays = m_nlay;
+  const auto col_updated = m_rad_col_updated;
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const int i = team.league_rank();
+    // With adaptive radiation, columns that were not recomputed still hold the pdel-scaled heating
+    const bool col_update_rad = update_rad and col_updated(i);
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k) {
-      if (update_rad) {
+      if (col_update_rad) {
         d_tmid(i,k) = d_tmid(i,k) + d_rad_heating_pdel(i,k) * dt;
         d_rad_heating_pdel(i,k) = d_pdel(i,k) * d_rad_heating_pdel(i,k);
       } else {
@@ -929,6 +1018,120 @@ void RRTMGPRadiation::run_impl (const double dt) {
 }
 // =========================================================================================
 
+void RRTMGPRadiation::select_adaptive_rad_columns () {
+  auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
+  auto d_tmid = get_field_out("T_mid").get_view<const Real**>();
+  auto d_qc = get_field_in("qc").get_view<const Real**>();
+  auto d_qi = get_field_in("qi").get_view<const Real**>();
+  auto d_cldfrac_tot = get_field_in("cldfrac_tot").get_view<const Real**>();
+  auto d_sfc_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto d_sfc_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto d_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto d_sfc_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+
+  const auto sfc_alb = m_rad_sfc_alb;
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,m_ncol), KOKKOS_LAMBDA(const int i) {
+    sfc_alb(i,0) = d_sfc_alb_dir_vis(i);
+    sfc_alb(i,1) = d_sfc_alb_dir_nir(i);
+    sfc_alb(i,2) = d_sfc_alb_dif_vis(i);
+    sfc_alb(i,3) = d_sfc_alb_dif_nir(i);
+  });
+
+  select_adaptive_rad_columns(m_ncol, m_nlay, m_adaptive_rad_inited, m_adaptive_rad_tols,
+                              d_tmid, d_cldfrac_tot, d_qc, d_qi, d_pdel, sfc_alb,
+                              m_buffer.cosine_zenith, m_adaptive_rad_state, m_rad_col_updated);
+
+  m_adaptive_rad_inited = true;
+}
+
+void RRTMGPRadiation::
+select_adaptive_rad_columns (const int ncol, const int nlay, const bool inited,
+                             const AdaptiveRadTols& tols,
+                             const view_2d_real_const& d_tmid,
+                             const view_2d_real_const& d_cldfrac_tot,
+                             const view_2d_real_const& d_qc,
+                             const view_2d_real_const& d_qi,
+                             const view_2d_real_const& d_pdel,
+                             const view_2d_real_const& d_sfc_alb,
+                             const view_1d_real_const& d_mu0,
+                             const AdaptiveRadState& state,
+                             const view_1d_int& updated)
+{
+  using PC = scream::physics::Constants<Real>;
+
+  // Copy to local variables, for lambda capture
+  const auto T_tol       = tols.T;
+  const auto cldfrac_tol = tols.cldfrac;
+  const auto wp_tol      = tols.water_path;
+  const auto alb_tol     = tols.albedo;
+  const auto max_skip    = tols.max_skip;
+  const auto num_skips   = state.num_skips;
+  const auto was_sunlit  = state.was_sunlit;
+  const auto ref_T_mid   = state.ref_T_mid;
+  const auto ref_cldfrac = state.ref_cldfrac;
+  const auto ref_wp      = state.ref_water_path;
+  const auto ref_alb     = state.ref_sfc_alb;
+  constexpr Real gravit  = PC::gravit;
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlay);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int i = team.league_rank();
+
+    // Largest change of T and cloud fraction, and current water paths
+    Real dT_max = 0, dcld_max = 0, lwp = 0, iwp = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& m) {
+      m = ekat::impl::max(m,std::abs(d_tmid(i,k)-ref_T_mid(i,k)));
+    }, Kokkos::Max<Real>(dT_max));
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& m) {
+      m = ekat::impl::max(m,std::abs(d_cldfrac_tot(i,k)-ref_cldfrac(i,k)));
+    }, Kokkos::Max<Real>(dcld_max));
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& wp) {
+      wp += d_qc(i,k)*d_pdel(i,k)/gravit;
+    }, lwp);
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k, Real& wp) {
+      wp += d_qi(i,k)*d_pdel(i,k)/gravit;
+    }, iwp);
+
+    Real dalb_max = 0;
+    for (int j=0; j<4; ++j) {
+      dalb_max = ekat::impl::max(dalb_max,std::abs(d_sfc_alb(i,j)-ref_alb(i,j)));
+    }
+
+    // SW fluxes depend on the zenith angle, which changes at every step, so sunlit
+    // columns (and columns whose SW fluxes are from when they were sunlit) are always recomputed
+    const bool sunlit = d_mu0(i) > 0;
+    const bool recompute = not inited or sunlit or was_sunlit(i)>0 or num_skips(i)>=max_skip or
+                           dT_max>T_tol or dcld_max>cldfrac_tol or dalb_max>alb_tol or
+                           std::abs(lwp-ref_wp(i,0))>wp_tol or std::abs(iwp-ref_wp(i,1))>wp_tol;
+
+    // Wait for all threads to be done reading the reference state
+    team.team_barrier();
+
+    if (recompute) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+        ref_T_mid(i,k)   = d_tmid(i,k);
+        ref_cldfrac(i,k) = d_cldfrac_tot(i,k);
+      });
+    }
+    Kokkos::single(Kokkos::PerTeam(team), [&] {
+      updated(i) = recompute ? 1 : 0;
+      if (recompute) {
+        num_skips(i)  = 0;
+        was_sunlit(i) = sunlit ? 1 : 0;
+        ref_wp(i,0) = lwp;
+        ref_wp(i,1) = iwp;
+        for (int j=0; j<4; ++j) {
+          ref_alb(i,j) = d_sfc_alb(i,j);
+        }
+      } else {
+        num_skips(i) += 1;
+      }
+    });
+  });
+  Kokkos::fence();
+}
+// =========================================================================================
+
 void RRTMGPRadiation::finalize_impl  () {
   m_gas_concs.reset();
   rrtmgp::rrtmgp_finalize();
@@ -19,7 +19,9 @@ public:
   using view_1d_real     = typename ekat::KokkosTypes<DefaultDevice>::template view_1d<Real>;
   using view_2d_real     = typename ekat::KokkosTypes<DefaultDevice>::template view_2d<Real>;
   using view_3d_real     = typename ekat::KokkosTypes<DefaultDevice>::template view_3d<Real>;
+  using view_1d_real_const = typename ekat::KokkosTypes<DefaultDevice>::template view_1d<const Real>;
   using view_2d_real_const = typename ekat::KokkosTypes<DefaultDevice>::template view_2d<const Real>;
+  using view_1d_int      = typename ekat::KokkosTypes<DefaultDevice>::template view_1d<int>;
   using ci_string        = ekat::CaseInsensitiveString;
 
   using KT               = ekat::KokkosTypes<DefaultDevice>;
@@ -45,11 +47,55 @@ public:
   void run_impl        (const double dt);
   void finalize_impl   ();
 
+  // Adaptive radiation: at each radiation step, only recompute the fluxes of the
+  // columns whose state changed enough since they were last computed. Sunlit columns,
+  // and columns that were sunlit last time, are always recomputed. A column is
+  // also recomputed if it was skipped max_skip times in a row.
+  struct AdaptiveRadTols {
+    Real T;           // Max change of T_mid [K]
+    Real cldfrac;     // Max change of cldfrac_tot
+    Real water_path;  // Max change of liquid/ice water paths [kg/m2]
+    Real albedo;      // Max change of surface albedos
+    int  max_skip;
+  };
+  // State of each column at the last radiation step where it was recomputed.
+  // In the model, these are views of RESTART fields, so that a restarted run
+  // skips the same columns as the original one.
+  struct AdaptiveRadState {
+    view_1d_real num_skips;       // Radiation steps skipped since then
+    view_1d_real was_sunlit;      // 1 if the column was sunlit, 0 otherwise
+    view_2d_real ref_T_mid;
+    view_2d_real ref_cldfrac;
+    view_2d_real ref_water_path;  // (ncol,2): liquid, ice
+    view_2d_real ref_sfc_alb;     // (ncol,4): dir_vis, dir_nir, dif_vis, dif_nir
+  };
+
+  // Set updated(i)=1 for the columns whose fluxes must be recomputed, 0 for the
+  // others, and update the state accordingly. If not inited, all columns are recomputed.
+  // Must be public, since it launches a device kernel (CUDA).
+  static void select_adaptive_rad_columns (const int ncol, const int nlay, const bool inited,
+                                           const AdaptiveRadTols& tols,
+                                           const view_2d_real_const& T_mid,
+                                           const view_2d_real_const& cldfrac_tot,
+                                           const view_2d_real_const& qc,
+                                           const view_2d_real_const& qi,
+                                           const view_2d_real_const& pdel,
+                                           const view_2d_real_const& sfc_alb,
+                                           const view_1d_real_const& mu0,
+                                           const AdaptiveRadState& state,
+                                           const view_1d_int& updated);
+  void select_adaptive_rad_columns ();
+
   // Keep track of number of columns and levels
   int m_ncol;
   int m_num_col_chunks;
   int m_col_chunk_size;
   std::vector<int> m_col_chunk_beg;
+  // Chunks are made of the columns m_col_perm(m_col_chunk_beg[ic]...m_col_chunk_beg[ic+1]).
+  // The permutation is recomputed at each radiation step, so that the sunlit columns
+  // come first, which means SW runs on full chunks of sunlit columns.
+  view_1d_int m_col_perm;
+  view_1d_int::HostMirror m_col_perm_h;
   int m_nlay;
   Field m_lat;
   Field m_lon;
@@ -100,9 +146,21 @@ public:
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
+  // Adaptive radiation (see select_adaptive_rad_columns)
+  bool m_adaptive_rad;
+  bool m_adaptive_rad_inited = false;
+  AdaptiveRadTols  m_adaptive_rad_tols;
+  AdaptiveRadState m_adaptive_rad_state;
+  view_2d_real     m_rad_sfc_alb;  // (ncol,4): current surface albedos
+
+  // Whether each column was recomputed in the last radiation step
+  view_1d_int              m_rad_col_updated;
+  view_1d_int::HostMirror  m_rad_col_updated_h;
+
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-    static constexpr int num_1d_ncol        = 10;
+    static constexpr int num_1d_ncol        = 9;
+    static constexpr int num_1d_ncol_all    = 1;
     static constexpr int num_2d_nlay        = 13;
     static constexpr int num_2d_nlay_p1     = 12;
     static constexpr int num_2d_nswbands    = 2;
@@ -119,12 +177,14 @@ public:
     real1d sfc_alb_dir_nir;
     real1d sfc_alb_dif_vis;
     real1d sfc_alb_dif_nir;
-    uview_1d<Real> cosine_zenith;
     real1d sfc_flux_dir_vis;
     real1d sfc_flux_dir_nir;
     real1d sfc_flux_dif_vis;
     real1d sfc_flux_dif_nir;
 
+    // 1d size (all columns, not just a chunk)
+    uview_1d<Real> cosine_zenith;
+
     // 2d size (ncol, nlay)
     real2d p_lay;
     real2d t_lay;
@@ -7,6 +7,7 @@
 #include "cpp/extensions/cloud_optics/mo_cloud_optics.h"
 #include "cpp/rte/mo_rte_sw.h"
 #include "cpp/rte/mo_rte_lw.h"
+#include "share/util/scream_timing.hpp"
 
 namespace scream {
     void yakl_init ()
@@ -331,6 +332,7 @@ namespace scream {
 #endif
 
             // Do shortwave
+            start_timer("EAMxx::RRTMGP::rrtmgp_sw");
             rrtmgp_sw(
                 ncol, nlay,
                 k_dist_sw, p_lay, t_lay, p_lev, t_lev, gas_concs, 
@@ -338,14 +340,17 @@ namespace scream {
                 fluxes_sw, clrsky_fluxes_sw,
                 tsi_scaling, logger
             );
+            stop_timer("EAMxx::RRTMGP::rrtmgp_sw");
 
             // Do longwave
+            start_timer("EAMxx::RRTMGP::rrtmgp_lw");
             rrtmgp_lw(
                 ncol, nlay,
                 k_dist_lw, p_lay, t_lay, p_lev, t_lev, gas_concs,
                 aerosol_lw, clouds_lw_gpt,
                 fluxes_lw, clrsky_fluxes_lw
             );
+            stop_timer("EAMxx::RRTMGP::rrtmgp_lw");
             
         }
 
@@ -608,22 +613,22 @@ namespace scream {
                 bnd_flux_dn_dir(icol,ilev,ibnd) = 0;
             });
  
-            // Get daytime indices
+            // Get daytime indices, compacting the sunlit columns on device.
+            // The scan preserves the order of the columns.
             auto dayIndices = int1d("dayIndices", ncol);
             memset(dayIndices, -1);
-            // Loop below has to be done on host, so create host copies
-            // TODO: there is probably a way to do this on the device
-            auto dayIndices_h = dayIndices.createHostCopy();
-            auto mu0_h = mu0.createHostCopy();
             int nday = 0;
-            for (int icol = 1; icol <= ncol; icol++) {
-                if (mu0_h(icol) > 0) {
-                    nday++;
-                    dayIndices_h(nday) = icol;
+            Kokkos::parallel_scan(Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0,ncol),
+                                  KOKKOS_LAMBDA(const int i, int& iday, const bool final) {
+                const int icol = i+1;
+                if (mu0(icol) > 0) {
+                    // Note that for YAKL arrays indices start from 1
+                    ++iday;
+                    if (final) {
+                        dayIndices(iday) = icol;
+                    }
                 }
-            }
-            // Copy data back to the device
-            dayIndices_h.deep_copy_to(dayIndices);
+            }, nday);
             if (nday == 0) { 
                 // No daytime columns in this chunk, skip the rest of this routine
                 return;
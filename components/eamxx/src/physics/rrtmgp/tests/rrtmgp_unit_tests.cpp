@@ -1,6 +1,7 @@
 #include "catch2/catch.hpp"
 #include "physics/rrtmgp/rrtmgp_utils.hpp"
 #include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
+#include "physics/rrtmgp/atmosphere_radiation.hpp"
 #include "YAKL.h"
 #include "physics/share/physics_constants.hpp"
 #include "physics/rrtmgp/shr_orb_mod_c2f.hpp"
@@ -619,3 +620,129 @@ TEST_CASE("rrtmgp_cloud_area") {
     cldtot.deallocate();
     yakl::finalize();
 }
+
+TEST_CASE("rrtmgp_test_adaptive_rad_columns") {
+    using Rad = scream::RRTMGPRadiation;
+    using scream::Real;
+    using PC = scream::physics::Constants<Real>;
+
+    const int ncol = 4;
+    const int nlay = 3;
+    Rad::AdaptiveRadTols tols;
+    tols.T = 1.0;
+    tols.cldfrac = 0.05;
+    tols.water_path = 1e-3;
+    tols.albedo = 0.01;
+    tols.max_skip = 2;
+
+    Rad::view_2d_real T_mid("T_mid",ncol,nlay), cldfrac("cldfrac",ncol,nlay);
+    Rad::view_2d_real qc("qc",ncol,nlay), qi("qi",ncol,nlay), pdel("pdel",ncol,nlay);
+    Rad::view_2d_real sfc_alb("sfc_alb",ncol,4);
+    Rad::view_1d_real mu0("mu0",ncol);
+    Rad::view_1d_int updated("updated",ncol);
+    auto T_mid_h   = Kokkos::create_mirror_view(T_mid);
+    auto cldfrac_h = Kokkos::create_mirror_view(cldfrac);
+    auto qc_h      = Kokkos::create_mirror_view(qc);
+    auto sfc_alb_h = Kokkos::create_mirror_view(sfc_alb);
+    auto mu0_h     = Kokkos::create_mirror_view(mu0);
+    auto updated_h = Kokkos::create_mirror_view(updated);
+
+    auto make_state = [&] () {
+      Rad::AdaptiveRadState state;
+      state.num_skips      = Rad::view_1d_real("num_skips",ncol);
+      state.was_sunlit     = Rad::view_1d_real("was_sunlit",ncol);
+      state.ref_T_mid      = Rad::view_2d_real("ref_T_mid",ncol,nlay);
+      state.ref_cldfrac    = Rad::view_2d_real("ref_cldfrac",ncol,nlay);
+      state.ref_water_path = Rad::view_2d_real("ref_water_path",ncol,2);
+      state.ref_sfc_alb    = Rad::view_2d_real("ref_sfc_alb",ncol,4);
+      return state;
+    };
+    auto copy_state = [] (const Rad::AdaptiveRadState& dst, const Rad::AdaptiveRadState& src) {
+      Kokkos::deep_copy(dst.num_skips,src.num_skips);
+      Kokkos::deep_copy(dst.was_sunlit,src.was_sunlit);
+      Kokkos::deep_copy(dst.ref_T_mid,src.ref_T_mid);
+      Kokkos::deep_copy(dst.ref_cldfrac,src.ref_cldfrac);
+      Kokkos::deep_copy(dst.ref_water_path,src.ref_water_path);
+      Kokkos::deep_copy(dst.ref_sfc_alb,src.ref_sfc_alb);
+    };
+    auto select_cols = [&] (const bool inited, const Rad::AdaptiveRadState& state,
+                       const std::vector<int>& expected) {
+      Kokkos::deep_copy(T_mid,T_mid_h);
+      Kokkos::deep_copy(cldfrac,cldfrac_h);
+      Kokkos::deep_copy(qc,qc_h);
+      Kokkos::deep_copy(sfc_alb,sfc_alb_h);
+      Kokkos::deep_copy(mu0,mu0_h);
+      Rad::select_adaptive_rad_columns(ncol,nlay,inited,tols,T_mid,cldfrac,qc,qi,pdel,
+                                       sfc_alb,mu0,state,updated);
+      Kokkos::deep_copy(updated_h,updated);
+      for (int i=0; i<ncol; ++i) {
+        REQUIRE (updated_h(i)==expected[i]);
+      }
+    };
+
+    // Column 1 is sunlit, the others are not
+    Kokkos::deep_copy(T_mid_h,250);
+    Kokkos::deep_copy(cldfrac_h,0.5);
+    Kokkos::deep_copy(qc_h,1e-5);
+    Kokkos::deep_copy(qi,0);
+    Kokkos::deep_copy(pdel,1000);
+    Kokkos::deep_copy(sfc_alb_h,0.2);
+    Kokkos::deep_copy(mu0_h,0);
+    mu0_h(1) = 0.5;
+
+    // The first time, all columns are recomputed, and the reference state is set
+    auto state = make_state();
+    select_cols(false,state,{1,1,1,1});
+    {
+      auto ref_T_mid_h  = Kokkos::create_mirror_view(state.ref_T_mid);
+      auto ref_wp_h     = Kokkos::create_mirror_view(state.ref_water_path);
+      auto was_sunlit_h = Kokkos::create_mirror_view(state.was_sunlit);
+      Kokkos::deep_copy(ref_T_mid_h,state.ref_T_mid);
+      Kokkos::deep_copy(ref_wp_h,state.ref_water_path);
+      Kokkos::deep_copy(was_sunlit_h,state.was_sunlit);
+      for (int i=0; i<ncol; ++i) {
+        REQUIRE (ref_T_mid_h(i,nlay-1)==250);
+        REQUIRE (ref_wp_h(i,0)==Approx(nlay*1e-5*1000/PC::gravit));
+        REQUIRE (was_sunlit_h(i)==(i==1 ? 1 : 0));
+      }
+    }
+
+    // Now it is night everywhere. Column 1 was sunlit, so it is recomputed anyways.
+    // Column 2 changed T more than the tolerance, column 3 less than the tolerance.
+    mu0_h(1) = 0;
+    for (int k=0; k<nlay; ++k) {
+      T_mid_h(2,k) += 2;
+      T_mid_h(3,k) += 0.5;
+    }
+    select_cols(true,state,{0,1,1,0});
+
+    // Nothing changed since the last step
+    select_cols(true,state,{0,0,0,0});
+
+    // Columns 0 and 3 were skipped max_skip times, column 1 changed albedo
+    sfc_alb_h(1,2) += 0.05;
+    select_cols(true,state,{1,1,0,1});
+    {
+      auto num_skips_h = Kokkos::create_mirror_view(state.num_skips);
+      Kokkos::deep_copy(num_skips_h,state.num_skips);
+      REQUIRE (num_skips_h(0)==0);
+      REQUIRE (num_skips_h(2)==2);
+    }
+
+    // Column 0 changed cloud fraction, column 1 changed liquid water path,
+    // column 2 was skipped max_skip times
+    cldfrac_h(0,0) += 0.1;
+    for (int k=0; k<nlay; ++k) {
+      qc_h(1,k) = 1e-4;
+    }
+    select_cols(true,state,{1,1,1,0});
+
+    // A run restarted from a copy of the state selects the same columns as the
+    // original one, while a run that does not restart it recomputes all columns
+    auto restarted = make_state();
+    copy_state(restarted,state);
+    T_mid_h(0,1) += 1.5;
+    select_cols(true,state,{1,0,0,0});
+    select_cols(true,restarted,{1,0,0,0});
+    select_cols(false,make_state(),{1,1,1,1});
+}
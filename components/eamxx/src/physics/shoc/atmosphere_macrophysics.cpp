@@ -3,6 +3,7 @@
 
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
+#include "share/util/scream_timing.hpp"
 
 #include "scream_config.h" // for SCREAM_CIME_BUILD
 
@@ -446,16 +447,23 @@ void SHOCMacrophysics::run_impl (const double dt)
       "Error! SHOC is intended to run with a timestep no longer than 5 minutes.\n"
       "       Please, reduce timestep (perhaps increasing subcycling iteratinos).\n");
 
+  // Level 1 timers, started every step, so their GPTL handles are cached (see TimerHandle)
+  static TimerHandle<1> preproc_timer("EAMxx::SHOC::preprocess");
+  static TimerHandle<1> main_timer("EAMxx::SHOC::shoc_main");
+  static TimerHandle<1> postproc_timer("EAMxx::SHOC::postprocess");
+
   const auto nlev_packs  = ekat::npack<Spack>(m_num_levs);
   const auto scan_policy    = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(m_num_cols, nlev_packs);
   const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
 
   // Preprocessing of SHOC inputs. Kernel contains a parallel_scan,
   // so a special TeamPolicy is required.
+  preproc_timer.start();
   Kokkos::parallel_for("shoc_preprocess",
                        scan_policy,
                        shoc_preprocess);
   Kokkos::fence();
+  preproc_timer.stop();
 
   // For now set the host timestep to the shoc timestep. This forces
   // number of SHOC timesteps (nadv) to be 1.
@@ -467,18 +475,23 @@ void SHOCMacrophysics::run_impl (const double dt)
   workspace_mgr.reset_internals();
 
   // Run shoc main
+  // NOTE: shoc_main fences before returning
+  main_timer.start();
   SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
                  workspace_mgr,input,input_output,output,history_output
 #ifdef SCREAM_SMALL_KERNELS
                  , temporaries
 #endif
                  );
+  main_timer.stop();
 
   // Postprocessing of SHOC outputs
+  postproc_timer.start();
   Kokkos::parallel_for("shoc_postprocess",
                        default_policy,
                        shoc_postprocess);
   Kokkos::fence();
+  postproc_timer.stop();
 }
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
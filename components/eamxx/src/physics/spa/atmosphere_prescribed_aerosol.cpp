@@ -2,6 +2,7 @@
 
 #include "share/util/scream_time_stamp.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_time_slab_reader.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/property_checks/field_lower_bound_check.hpp"
 
@@ -182,11 +183,16 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_start = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_end   = SPAFunc::SPAInput(m_dofs_gids.size(), m_num_src_levs+2, m_nswbands, m_nlwbands);
 
+  // Create the reader for the SPA data, only reading the source columns we need.
+  // Optionally, prefetch the next month on the async IO thread (see TimeSlabReader)
+  const bool async_prefetch = m_params.get<bool>("async_prefetch",false);
+  m_spa_data_reader = SPAFunc::create_spa_data_reader(m_spa_data_file,m_nswbands,m_nlwbands,SPAHorizInterp,3,async_prefetch);
+
   // Update the local time state information and load the first set of SPA data for interpolation:
   auto ts = timestamp();
   SPATimeState.inited = false;
   SPATimeState.current_month = ts.get_month();
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(*m_spa_data_reader,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
 
   // Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -208,7 +214,10 @@ void SPA::run_impl (const double dt)
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
   /* Update time state and if the month has changed, update the data.*/
-  SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  SPAFunc::update_spa_timestate(*m_spa_data_reader,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  /* Start reading the data for the month after next, so it is ready at the next rollover.
+   * Note: current_month is one-based, while the reader uses zero-based time indices. */
+  m_spa_data_reader->prefetch((SPATimeState.current_month+1)%12);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Pack**>();
@@ -219,7 +228,7 @@ void SPA::run_impl (const double dt)
 // =========================================================================================
 void SPA::finalize_impl()
 {
-  // Do nothing
+  m_spa_data_reader->finalize();
 }
 
 } // namespace scream
@@ -47,6 +47,9 @@ public:
   // The name of the subcomponent
   std::string name () const { return "spa"; }
 
+  // SPA reads the monthly aerosol data while running
+  bool does_io_in_run () const { return true; }
+
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
@@ -100,6 +103,10 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // Reads the monthly SPA data, prefetching next month's data ahead of time.
+  // The SPA data file stays open until finalize_impl.
+  std::shared_ptr<TimeSlabReader> m_spa_data_reader;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA 
 
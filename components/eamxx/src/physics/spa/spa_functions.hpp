@@ -11,7 +11,12 @@
 #include "ekat/ekat_workspace.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
 
+#include <memory>
+
 namespace scream {
+
+class TimeSlabReader;
+
 namespace spa {
 
 template <typename ScalarType, typename DeviceType>
@@ -182,6 +187,17 @@ struct SPAFunctions
     const view_1d<const gid_type>& dofs_gids,
           SPAHorizInterp&          spa_horiz_interp);
 
+  // Create a reader for the SPA data file, which reads only the source
+  // columns needed by spa_horiz_interp, and keeps the monthly data on device.
+  // If async_prefetch=true, the next month is read on the async IO thread.
+  static std::shared_ptr<TimeSlabReader> create_spa_data_reader(
+    const std::string&    spa_data_file_name,
+    const int             nswbands,
+    const int             nlwbands,
+    const SPAHorizInterp& spa_horiz_interp,
+    const int             num_slots = 3,
+    const bool            async_prefetch = false);
+
   static void update_spa_data_from_file(
     const std::string&    spa_data_file_name,
     const int             time_index,
@@ -190,8 +206,17 @@ struct SPAFunctions
           SPAHorizInterp& spa_horiz_interp,
           SPAInput&       spa_data);
 
+  // Same as above, but reading from a (possibly prefetched) slab of the reader
+  static void update_spa_data_from_file(
+          TimeSlabReader& spa_data_reader,
+    const int             time_index,
+    const int             nswbands,
+    const int             nlwbands,
+          SPAHorizInterp& spa_horiz_interp,
+          SPAInput&       spa_data);
+
   static void update_spa_timestate(
-    const std::string&     spa_data_file_name,
+          TimeSlabReader&  spa_data_reader,
     const int              nswbands,
     const int              nlwbands,
     const util::TimeStamp& ts,
@@ -4,6 +4,7 @@
 #include "share/scream_types.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_time_slab_reader.hpp"
 #include "share/grid/point_grid.hpp"
 #include "physics/share/physics_constants.hpp"
 
@@ -351,6 +352,85 @@ void SPAFunctions<S,D>
   stop_timer("EAMxx::SPA::get_remap_weights_from_file");
 
 }  // END get_remap_weights_from_file
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+std::shared_ptr<TimeSlabReader> SPAFunctions<S,D>
+::create_spa_data_reader(
+    const std::string&          spa_data_file_name,
+    const int                   nswbands,
+    const int                   nlwbands,
+    const SPAHorizInterp&       spa_horiz_interp,
+    const int                   num_slots,
+    const bool                  async_prefetch)
+{
+  // Each rank reads only the source columns it needs, all ranks taking part in
+  // one collective read (so PIO can spread the work over its IO ranks)
+  auto comm = spa_horiz_interp.m_comm;
+
+  // Use HorizontalMap to define the set of source column data we need to load
+  const auto& spa_horiz_map = spa_horiz_interp.horiz_map;
+  auto unique_src_dofs = spa_horiz_map.get_unique_source_dofs();
+  const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
+  scorpio::register_file(spa_data_file_name,scorpio::Read);
+  const int source_data_nlevs = scorpio::get_dimlen(spa_data_file_name,"lev");
+
+  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen(spa_data_file_name,"swband"),
+      "ERROR create_spa_data_reader: Number of SW bands in simulation doesn't match the SPA data file");
+  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen(spa_data_file_name,"lwband"),
+      "ERROR create_spa_data_reader: Number of LW bands in simulation doesn't match the SPA data file");
+
+  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
+  ekat::ParameterList spa_data_in_params;
+  spa_data_in_params.set("Field Names",fnames);
+  spa_data_in_params.set("Filename",spa_data_file_name);
+  spa_data_in_params.set("Subset_Read",true);  // Multiple ranks may want the same column of source data.
+  spa_data_in_params.set("async_prefetch",async_prefetch);
+
+  // Construct the grid needed for input. Its gids are the (zero-based) columns in the file
+  auto grid = std::make_shared<PointGrid>("spa_src_grid",num_local_cols,source_data_nlevs,comm);
+  Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
+  grid->get_dofs_gids().sync_to_host();
+
+  // Set up the layouts of the input variables.
+  using namespace ShortFieldTagsNames;
+  FieldLayout scalar1d_layout { {LEV}, {source_data_nlevs} };
+  FieldLayout scalar2d_layout_mid { {COL}, {num_local_cols} };
+  FieldLayout scalar3d_layout_mid { {COL,LEV}, {num_local_cols, source_data_nlevs} };
+  FieldLayout scalar3d_swband_layout { {COL,SWBND, LEV}, {num_local_cols, nswbands, source_data_nlevs} };
+  FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {num_local_cols, nlwbands, source_data_nlevs} };
+  std::map<std::string,FieldLayout>  layouts;
+  layouts.emplace("hyam", scalar1d_layout);
+  layouts.emplace("hybm", scalar1d_layout);
+  layouts.emplace("PS", scalar2d_layout_mid);
+  layouts.emplace("CCN3",scalar3d_layout_mid);
+  layouts.emplace("AER_G_SW",scalar3d_swband_layout);
+  layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
+  layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
+  layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
+
+  auto reader = std::make_shared<TimeSlabReader>(spa_data_in_params,grid,layouts,num_slots);
+  scorpio::eam_pio_closefile(spa_data_file_name);
+
+  return reader;
+}
+
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_data_from_file(
+    const std::string&          spa_data_file_name,
+    const int                   time_index, // zero-based
+    const int                   nswbands,
+    const int                   nlwbands,
+          SPAHorizInterp&       spa_horiz_interp,
+          SPAInput&             spa_data)
+{
+  // A one-shot reader: we only need two slots, since nothing is prefetched
+  auto reader = create_spa_data_reader(spa_data_file_name,nswbands,nlwbands,spa_horiz_interp,2);
+  update_spa_data_from_file(*reader,time_index,nswbands,nlwbands,spa_horiz_interp,spa_data);
+  reader->finalize();
+}
+
 /*-----------------------------------------------------------------*/
 /* Note: In this routine the SPA source data is padded in the vertical
  * to facilitate the proper behavior at the boundaries when doing the
@@ -398,7 +478,7 @@ void SPAFunctions<S,D>
 template<typename S, typename D>
 void SPAFunctions<S,D>
 ::update_spa_data_from_file(
-    const std::string&          spa_data_file_name,
+          TimeSlabReader&       spa_data_reader,
     const int                   time_index, // zero-based
     const int                   nswbands,
     const int                   nlwbands,
@@ -406,109 +486,37 @@ void SPAFunctions<S,D>
           SPAInput&             spa_data)
 {
   start_timer("EAMxx::SPA::update_spa_data_from_file");
-  // Ensure all ranks are operating independently when reading the file, so there's a copy on all ranks
-  auto comm = spa_horiz_interp.m_comm;
-
-  // Use HorizontalMap to define the set of source column data we need to load
   auto& spa_horiz_map = spa_horiz_interp.horiz_map;
-  auto unique_src_dofs = spa_horiz_map.get_unique_source_dofs();
   const int num_local_cols = spa_horiz_map.get_num_unique_dofs();
-  scorpio::register_file(spa_data_file_name,scorpio::Read);
-  const int source_data_nlevs = scorpio::get_dimlen(spa_data_file_name,"lev");
+  const int source_data_nlevs = spa_data_reader.get_layout("hyam").size();
+
+  // Check that padding matches source size:
+  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
 
-  // Construct local arrays to read data into
-  // Note, all of the views being created here are meant to hold the source resolution
-  // data that will need to be horizontally interpolated to the simulation grid using the remap
-  // data.  For example, 
-  //   We will first define the data surface pressure PS_v and read that from file.
+  // Make sure the data for this month is on device. This is a no-op if the
+  // month was already read (or prefetched).
+  // Note, all of the data loaded here is at the source resolution, and will
+  // need to be horizontally interpolated to the simulation grid using the remap
+  // data.  For example,
+  //   We will first get the data surface pressure PS_v from the reader,
   //   then we will use the horizontal interpolation structure, spa_horiz_interp, to
   //   interpolate PS_v onto the simulation grid: PS_v -> spa_data.PS
   //   and so on for the other variables.
   start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
-  std::vector<std::string> fnames = {"hyam","hybm","PS","CCN3","AER_G_SW","AER_SSA_SW","AER_TAU_SW","AER_TAU_LW"};
-  ekat::ParameterList spa_data_in_params;
-  spa_data_in_params.set("Field Names",fnames);
-  spa_data_in_params.set("Filename",spa_data_file_name);
-  spa_data_in_params.set("Skip_Grid_Checks",true);  // We need to skip grid checks because multiple ranks may want the same column of source data.
-  
-  // Construct the grid needed for input:
-  auto grid = std::make_shared<PointGrid>("grid",num_local_cols,source_data_nlevs,comm);
-  Kokkos::deep_copy(grid->get_dofs_gids().template get_view<gid_type*>(),unique_src_dofs);
-  grid->get_dofs_gids().sync_to_host();
-
-  // Check that padding matches source size:
-  EKAT_REQUIRE(source_data_nlevs+2 == spa_data.data.nlevs);
-  EKAT_REQUIRE_MSG(nswbands==scorpio::get_dimlen(spa_data_file_name,"swband"),
-      "ERROR update_spa_data_from_file: Number of SW bands in simulation doesn't match the SPA data file");
-  EKAT_REQUIRE_MSG(nlwbands==scorpio::get_dimlen(spa_data_file_name,"lwband"),
-      "ERROR update_spa_data_from_file: Number of LW bands in simulation doesn't match the SPA data file");
-
-  // Constuct views to read source data in from file
-  typename view_1d<Real>::HostMirror hyam_v_h("hyam",source_data_nlevs);
-  typename view_1d<Real>::HostMirror hybm_v_h("hybm",source_data_nlevs);
-  view_1d<Real> PS_v("PS",num_local_cols);
-  view_2d<Real> CCN3_v("CCN3",num_local_cols,source_data_nlevs);
-  view_3d<Real> AER_G_SW_v("AER_G_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_SSA_SW_v("AER_SSA_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_SW_v("AER_TAU_SW",num_local_cols,nswbands,source_data_nlevs);
-  view_3d<Real> AER_TAU_LW_v("AER_TAU_LW",num_local_cols,nlwbands,source_data_nlevs);
-
-  auto PS_v_h         = Kokkos::create_mirror_view(PS_v);
-  auto CCN3_v_h       = Kokkos::create_mirror_view(CCN3_v);      
-  auto AER_G_SW_v_h   = Kokkos::create_mirror_view(AER_G_SW_v);
-  auto AER_SSA_SW_v_h = Kokkos::create_mirror_view(AER_SSA_SW_v);
-  auto AER_TAU_SW_v_h = Kokkos::create_mirror_view(AER_TAU_SW_v);
-  auto AER_TAU_LW_v_h = Kokkos::create_mirror_view(AER_TAU_LW_v);
-
-  // Set up input structure to read data from file.
-  using namespace ShortFieldTagsNames;
-  FieldLayout scalar1d_layout { {LEV}, {source_data_nlevs} };
-  FieldLayout scalar2d_layout_mid { {COL}, {num_local_cols} };
-  FieldLayout scalar3d_layout_mid { {COL,LEV}, {num_local_cols, source_data_nlevs} };
-  FieldLayout scalar3d_swband_layout { {COL,SWBND, LEV}, {num_local_cols, nswbands, source_data_nlevs} }; 
-  FieldLayout scalar3d_lwband_layout { {COL,LWBND, LEV}, {num_local_cols, nlwbands, source_data_nlevs} };
-  std::map<std::string,view_1d_host<Real>> host_views;
-  std::map<std::string,FieldLayout>  layouts;
-  // Define each input variable we need
-  host_views["hyam"] = view_1d_host<Real>(hyam_v_h.data(),hyam_v_h.size());
-  layouts.emplace("hyam", scalar1d_layout);
-  host_views["hybm"] = view_1d_host<Real>(hybm_v_h.data(),hybm_v_h.size());
-  layouts.emplace("hybm", scalar1d_layout);
-  //
-  host_views["PS"] = view_1d_host<Real>(PS_v_h.data(),PS_v_h.size());
-  layouts.emplace("PS", scalar2d_layout_mid);
-  //
-  host_views["CCN3"] = view_1d_host<Real>(CCN3_v_h.data(),CCN3_v_h.size());
-  layouts.emplace("CCN3",scalar3d_layout_mid);
-  //
-  host_views["AER_G_SW"] = view_1d_host<Real>(AER_G_SW_v_h.data(),AER_G_SW_v_h.size());
-  layouts.emplace("AER_G_SW",scalar3d_swband_layout);
-  //
-  host_views["AER_SSA_SW"] = view_1d_host<Real>(AER_SSA_SW_v_h.data(),AER_SSA_SW_v_h.size());
-  layouts.emplace("AER_SSA_SW",scalar3d_swband_layout);
-  //
-  host_views["AER_TAU_SW"] = view_1d_host<Real>(AER_TAU_SW_v_h.data(),AER_TAU_SW_v_h.size());
-  layouts.emplace("AER_TAU_SW",scalar3d_swband_layout);
-  //
-  host_views["AER_TAU_LW"] = view_1d_host<Real>(AER_TAU_LW_v_h.data(),AER_TAU_LW_v_h.size());
-  layouts.emplace("AER_TAU_LW",scalar3d_lwband_layout);
-  //
-  
-  // Now that we have all the variables defined we can use the scorpio_input class to grab the data.
-  AtmosphereInput spa_data_input(spa_data_in_params,grid,host_views,layouts);
-  spa_data_input.read_variables(time_index);
-  spa_data_input.finalize();
-  scorpio::eam_pio_closefile(spa_data_file_name);
+  spa_data_reader.load(time_index);
+  auto get_data = [&](const std::string& name) {
+    return spa_data_reader.get_data(name,time_index).data();
+  };
+  view_1d<Real> PS_v(get_data("PS"),num_local_cols);
+  view_2d<Real> CCN3_v(get_data("CCN3"),num_local_cols,source_data_nlevs);
+  view_3d<Real> AER_G_SW_v(get_data("AER_G_SW"),num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_SSA_SW_v(get_data("AER_SSA_SW"),num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_TAU_SW_v(get_data("AER_TAU_SW"),num_local_cols,nswbands,source_data_nlevs);
+  view_3d<Real> AER_TAU_LW_v(get_data("AER_TAU_LW"),num_local_cols,nlwbands,source_data_nlevs);
+  auto hyam_v_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),spa_data_reader.get_data("hyam",time_index));
+  auto hybm_v_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),spa_data_reader.get_data("hybm",time_index));
   stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
   start_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
-  // Copy data from host back to the device views.
-  Kokkos::deep_copy(PS_v,PS_v_h);
-  Kokkos::deep_copy(CCN3_v      , CCN3_v_h);      
-  Kokkos::deep_copy(AER_G_SW_v  , AER_G_SW_v_h);
-  Kokkos::deep_copy(AER_SSA_SW_v, AER_SSA_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_SW_v, AER_TAU_SW_v_h);
-  Kokkos::deep_copy(AER_TAU_LW_v, AER_TAU_LW_v_h);
-
   // Apply the remap to this data
   spa_horiz_map.apply_remap(PS_v,spa_data.PS); // Note PS is not padded, so remap can be applied right away
   // For padded data we need create temporary arrays to store the direct remapped data, then we can add
@@ -520,12 +528,19 @@ void SPAFunctions<S,D>
   view_3d<Real> AER_SSA_SW_unpad("",tgt_ncol,nswbands,tgt_nlev);
   view_3d<Real> AER_TAU_SW_unpad("",tgt_ncol,nswbands,tgt_nlev);
   view_3d<Real> AER_TAU_LW_unpad("",tgt_ncol,nlwbands,tgt_nlev);
-  // Apply remap to "unpadded" data
-  spa_horiz_map.apply_remap(CCN3_v,CCN3_unpad);
-  spa_horiz_map.apply_remap(AER_G_SW_v, AER_G_SW_unpad);
-  spa_horiz_map.apply_remap(AER_SSA_SW_v, AER_SSA_SW_unpad);
-  spa_horiz_map.apply_remap(AER_TAU_SW_v, AER_TAU_SW_unpad);
-  spa_horiz_map.apply_remap(AER_TAU_LW_v, AER_TAU_LW_unpad);
+  // Apply remap to "unpadded" data. All fields are remapped in a single pass over the map,
+  // seeing each of them as a 2d array (col,inner)
+  auto as_2d = [](const auto& v) {
+    using value_type = typename std::remove_reference<decltype(v)>::type::value_type;
+    return view_2d<value_type>(v.data(),v.extent(0),v.size()/v.extent(0));
+  };
+  const std::vector<view_2d<const Real>> remap_src = {
+    as_2d(CCN3_v), as_2d(AER_G_SW_v), as_2d(AER_SSA_SW_v), as_2d(AER_TAU_SW_v), as_2d(AER_TAU_LW_v)
+  };
+  const std::vector<view_2d<Real>> remap_tgt = {
+    as_2d(CCN3_unpad), as_2d(AER_G_SW_unpad), as_2d(AER_SSA_SW_unpad), as_2d(AER_TAU_SW_unpad), as_2d(AER_TAU_LW_unpad)
+  };
+  spa_horiz_map.apply_remap(remap_src,remap_tgt);
   stop_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
   start_timer("EAMxx::SPA::update_spa_data_from_file::copy_and_pad");
   // Copy unpadded data to SPA data structure, add padding.
@@ -615,7 +630,7 @@ void SPAFunctions<S,D>
 template<typename S, typename D>
 void SPAFunctions<S,D>
 ::update_spa_timestate(
-  const std::string&     spa_data_file_name,
+        TimeSlabReader&  spa_data_reader,
   const int              nswbands,
   const int              nlwbands,
   const util::TimeStamp& ts,
@@ -630,20 +645,27 @@ void SPAFunctions<S,D>
   //        any other frequency.
   const auto month = ts.get_month();
   if (month != time_state.current_month or !time_state.inited) {
+    const bool rollover = time_state.inited and
+                          month == (time_state.current_month==12 ? 1 : time_state.current_month+1);
 
     // Update the SPA time state information
     time_state.current_month = month;
     time_state.t_beg_month = util::TimeStamp({ts.get_year(),month,1}, {0,0,0}).frac_of_year_in_days();
     time_state.days_this_month = util::days_in_month(ts.get_year(),month);
     // Update the SPA forcing data for this month and next month
-    // Start by copying next months data to this months data structure.  
+    // If we simply moved to the next month, last month's 'end' data is this
+    // month's 'beg' data, so we only need to read next month's data.
     // NOTE: If the timestep is bigger than monthly this could cause the wrong values
     //       to be assigned.  A timestep greater than a month is very unlikely so we
     //       will proceed.
     // NOTE: we use zero-based time indexing here.
-    update_spa_data_from_file(spa_data_file_name,time_state.current_month-1,nswbands,nlwbands,spa_horiz_interp,spa_beg);
+    if (rollover) {
+      std::swap(spa_beg,spa_end);
+    } else {
+      update_spa_data_from_file(spa_data_reader,time_state.current_month-1,nswbands,nlwbands,spa_horiz_interp,spa_beg);
+    }
     int next_month = time_state.current_month==12 ? 1 : time_state.current_month+1;
-    update_spa_data_from_file(spa_data_file_name,next_month-1,nswbands,nlwbands,spa_horiz_interp,spa_end);
+    update_spa_data_from_file(spa_data_reader,next_month-1,nswbands,nlwbands,spa_horiz_interp,spa_end);
     // If time state was not initialized it is now:
     time_state.inited = true;
   }
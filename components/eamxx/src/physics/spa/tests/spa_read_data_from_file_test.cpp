@@ -111,7 +111,56 @@ TEST_CASE("spa_read_data","spa")
       }
     }
   }
-  
+
+  // Monthly update: at a month rollover, last month's 'end' data becomes this
+  // month's 'beg' data (std::swap in update_spa_timestate), so only next month
+  // is loaded, and it was already prefetched.
+  {
+    auto reader = SPAFunc::create_spa_data_reader(spa_data_file,nswbands,nlwbands,spa_horiz_interp);
+    SPAFunc::SPATimeState time_state;
+    SPAFunc::SPAInput spa_beg(dofs_gids.size(), nlevs+2, nswbands, nlwbands);
+    SPAFunc::SPAInput spa_end(dofs_gids.size(), nlevs+2, nswbands, nlwbands);
+    auto check_ps = [&](const SPAFunc::SPAInput& data, const int time_index) {
+      Kokkos::deep_copy(ps_h,data.PS);
+      for (size_t dof_i=0;dof_i<dofs_gids_h.size();dof_i++) {
+        REQUIRE(std::abs(ps_h(dof_i) - ps_func(time_index,ncols_src))<tol);
+      }
+    };
+    auto update = [&](const int month) {
+      util::TimeStamp ts({2000,month,15},{0,0,0});
+      SPAFunc::update_spa_timestate(*reader,nswbands,nlwbands,ts,spa_horiz_interp,
+                                    time_state,spa_beg,spa_end);
+      REQUIRE(time_state.current_month==month);
+    };
+
+    // January: data for months 0 and 1 is read
+    update(1);
+    REQUIRE(reader->get_num_reads()==2);
+    check_ps(spa_beg,0);
+    check_ps(spa_end,1);
+
+    // Prefetch the 'end' month of February, like SPA::run_impl does
+    reader->prefetch(2);
+    REQUIRE(reader->get_num_reads()==3);
+
+    // February: January's 'end' data is reused as 'beg' data, without copies
+    const auto jan_end_ps = spa_end.PS.data();
+    update(2);
+    REQUIRE(reader->get_num_reads()==3);
+    REQUIRE(spa_beg.PS.data()==jan_end_ps);
+    check_ps(spa_beg,1);
+    check_ps(spa_end,2);
+
+    // Back to January is not a rollover: both months are re-interpolated,
+    // but their data is still on device, so nothing is read from file
+    update(1);
+    REQUIRE(reader->get_num_reads()==3);
+    check_ps(spa_beg,0);
+    check_ps(spa_end,1);
+
+    reader->finalize();
+  }
+
   // All Done 
   scorpio::eam_pio_finalize();
 } // run_property
@@ -4,15 +4,40 @@
 #include "share/scream_types.hpp"
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace scream {
 
 // Struct which allows for the allocation of a single
 // memory buffer for all ATM processes.
+//
+// Memory can be requested in two ways:
+//  - anonymous requests: all of them alias the beginning of the buffer,
+//    so the buffer must be at least as large as the largest of them;
+//  - named requests: each of them comes with a range of "slots" during which
+//    the memory is in use (e.g., the position of the requesting atm proc in the
+//    execution order). Named requests go after the anonymous portion of the buffer,
+//    and two of them get disjoint memory only if their slot ranges overlap. Each
+//    request starts at a multiple of 'alignment' bytes.
+//
+// Named requests exist so that atm procs that may run concurrently do not share
+// scratch memory. They do not make the buffer smaller: when atm procs run one after
+// the other, all their requests alias the same memory, like anonymous requests do.
+// Only the atm procs scratch memory goes through this buffer: fields, remappers,
+// output and diagnostics allocate their own memory. See report() for the buffer
+// size compared to the largest single request.
 struct ATMBufferManager {
 
   template <typename S>
   using view_1d = typename KokkosTypes<DefaultDevice>::template view_1d<S>;
 
+  // Alignment (in bytes) of named requests: the largest of a pack and a cache line
+  static constexpr size_t alignment =
+    SCREAM_PACK_SIZE*sizeof(Real)>128 ? SCREAM_PACK_SIZE*sizeof(Real) : 128;
+
   ATMBufferManager()
   {
     m_size      = 0;
@@ -24,7 +49,8 @@ struct ATMBufferManager {
   // Each ATM process should request the number of bytes
   // needed for local variables. Since no two process runs at
   // the same time, the total allocation will be the maximum
-  // of each request.
+  // of each request. Atm procs that may run concurrently must
+  // use named requests instead (see below).
   void request_bytes (const size_t num_bytes) {
     ekat::error::runtime_check(num_bytes%sizeof(Real)==0,
                                "Error! Must request number of bytes which is divisible by sizeof(Real).\n");
@@ -33,6 +59,22 @@ struct ATMBufferManager {
     m_size = std::max(num_reals, m_size);
   }
 
+  // Request memory that is in use during the slots [first_slot,last_slot]
+  void request_bytes (const std::string& name, const size_t num_bytes,
+                      const int first_slot, const int last_slot) {
+    ekat::error::runtime_check(!m_allocated, "Error! Cannot request memory after the buffer is allocated.\n");
+    ekat::error::runtime_check(num_bytes%sizeof(Real)==0,
+                               "Error! Must request number of bytes which is divisible by sizeof(Real).\n");
+    ekat::error::runtime_check(first_slot<=last_slot, "Error! Invalid lifetime for buffer request '" + name + "'.\n");
+    ekat::error::runtime_check(m_allocations.count(name)==0,
+                               "Error! Buffer request '" + name + "' was already made.\n");
+
+    auto& a = m_allocations[name];
+    a.size = num_bytes/sizeof(Real);
+    a.first_slot = first_slot;
+    a.last_slot = last_slot;
+  }
+
   Real* get_memory () const { return m_buffer.data(); }
 
   size_t allocated_bytes () const { return m_size*sizeof(Real); }
@@ -40,17 +82,148 @@ struct ATMBufferManager {
   void allocate () {
     ekat::error::runtime_check(!m_allocated, "Error! Cannot call 'allocate' more than once.\n");
 
+    plan_allocations ();
+
     m_buffer = view_1d<Real>("",m_size);
     m_allocated = true;
   }
 
   bool allocated () const { return m_allocated; }
 
+  // Return a manager for the memory of a named request
+  ATMBufferManager get_allocation (const std::string& name) const {
+    auto it = m_allocations.find(name);
+    ekat::error::runtime_check(it!=m_allocations.end(),
+                               "Error! No buffer request named '" + name + "'.\n");
+    return slice(it->second.offset*sizeof(Real),it->second.size*sizeof(Real));
+  }
+
+  // The largest amount of memory requested at the same time, i.e., the anonymous
+  // portion plus the max over all slots of the sum of the live named requests.
+  // This is a lower bound for the buffer size. If only one atm proc runs at a
+  // time, it is the largest request, which is what a single max-sized anonymous
+  // request would allocate.
+  size_t peak_live_bytes () const { return m_peak_live_size*sizeof(Real); }
+
+  // The largest single request, i.e., the size of the buffer if all the requests
+  // were anonymous (which is how the buffer was sized before named requests).
+  size_t max_request_bytes () const { return m_max_request_size*sizeof(Real); }
+
+  // A summary of the buffer size and layout. The difference between the allocated
+  // and the largest request bytes is the extra memory needed by atm procs that run
+  // concurrently, while the difference between the allocated and the peak live
+  // bytes is the memory lost to alignment and fragmentation.
+  std::string report () const {
+    std::string s = "ATM buffer: " + std::to_string(allocated_bytes()) + " bytes (largest request: "
+                  + std::to_string(max_request_bytes()) + " bytes, peak live requests: "
+                  + std::to_string(peak_live_bytes()) + " bytes)\n";
+    for (const auto& it : m_allocations) {
+      const auto& a = it.second;
+      s += "  - " + it.first + ": offset=" + std::to_string(a.offset*sizeof(Real))
+         + ", size=" + std::to_string(a.size*sizeof(Real))
+         + ", slots=[" + std::to_string(a.first_slot) + "," + std::to_string(a.last_slot) + "]\n";
+    }
+    return s;
+  }
+
+  // Return a manager for the portion [offset,offset+num_bytes) of this buffer
+  ATMBufferManager slice (const size_t offset_bytes, const size_t num_bytes) const {
+    ekat::error::runtime_check(m_allocated, "Error! Cannot slice a buffer that was not allocated.\n");
+    ekat::error::runtime_check(offset_bytes%sizeof(Real)==0 && num_bytes%sizeof(Real)==0,
+                               "Error! Buffer slices must be aligned to sizeof(Real).\n");
+    ekat::error::runtime_check(offset_bytes+num_bytes<=allocated_bytes(),
+                               "Error! Buffer slice exceeds the buffer size.\n");
+
+    const size_t beg = offset_bytes/sizeof(Real);
+    const size_t end = beg + num_bytes/sizeof(Real);
+
+    ATMBufferManager sub;
+    sub.m_buffer = Kokkos::subview(m_buffer,Kokkos::make_pair(beg,end));
+    sub.m_size = end - beg;
+    sub.m_allocated = true;
+    return sub;
+  }
+
 protected:
 
+  struct Allocation {
+    size_t  offset = 0;
+    size_t  size = 0;
+    int     first_slot;
+    int     last_slot;
+  };
+
+  // Number of Real's in a multiple of alignment that holds n Real's
+  static size_t aligned_size (const size_t n) {
+    constexpr size_t a = alignment/sizeof(Real);
+    return (n+a-1)/a*a;
+  }
+
+  // Assign offsets to named requests. Requests are placed from largest to smallest,
+  // each at the lowest aligned offset that does not overlap any request already
+  // placed whose lifetime overlaps its own.
+  void plan_allocations () {
+    // Peak of the memory live at the same time. Lifetimes are intervals, so the
+    // peak is reached at the first slot of some request.
+    m_peak_live_size = m_size;
+    m_max_request_size = m_size;
+    for (const auto& it : m_allocations) {
+      m_max_request_size = std::max(m_max_request_size,it.second.size);
+      const int slot = it.second.first_slot;
+      size_t live = m_size;
+      for (const auto& other : m_allocations) {
+        if (other.second.first_slot<=slot && slot<=other.second.last_slot) {
+          live += other.second.size;
+        }
+      }
+      m_peak_live_size = std::max(m_peak_live_size,live);
+    }
+
+    std::vector<std::pair<std::string,Allocation*>> sorted;
+    for (auto& it : m_allocations) {
+      sorted.emplace_back(it.first,&it.second);
+    }
+    std::stable_sort(sorted.begin(),sorted.end(),
+        [](const std::pair<std::string,Allocation*>& lhs,
+           const std::pair<std::string,Allocation*>& rhs) {
+          return lhs.second->size>rhs.second->size;
+        });
+
+    const size_t anon_size = m_allocations.size()>0 ? aligned_size(m_size) : m_size;
+    std::vector<const Allocation*> placed;
+    for (auto& it : sorted) {
+      auto& a = *it.second;
+
+      // Memory ranges of already placed requests that are live at the same time as a
+      std::vector<std::pair<size_t,size_t>> busy;
+      for (auto b : placed) {
+        if (b->first_slot<=a.last_slot && a.first_slot<=b->last_slot) {
+          busy.emplace_back(b->offset,b->offset+aligned_size(b->size));
+        }
+      }
+      std::sort(busy.begin(),busy.end());
+
+      // Note: all the busy ranges start and end at aligned offsets
+      size_t offset = anon_size;
+      for (const auto& r : busy) {
+        if (offset+aligned_size(a.size)<=r.first) {
+          break;
+        }
+        offset = std::max(offset,r.second);
+      }
+      a.offset = offset;
+      m_size = std::max(m_size,offset+a.size);
+      placed.push_back(&a);
+    }
+  }
+
   view_1d<Real> m_buffer;
   size_t        m_size;
+  size_t        m_peak_live_size = 0;
+  size_t        m_max_request_size = 0;
   bool          m_allocated;
+
+  std::map<std::string,Allocation>  m_allocations;
 };
 
 } // scream
@@ -5,6 +5,7 @@
 
 #include "ekat/ekat_assert.hpp"
 
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -76,8 +77,17 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 }
 
 void AtmosphereProcess::run (const double dt) {
-  start_timer (m_timer_prefix + this->name() + "::run");
-  if (m_params.get("enable_precondition_checks", true)) {
+  // GPTL timers and timing scopes can only be used from the main thread
+  std::unique_ptr<TimingScope> timing_scope;
+  if (not m_concurrent_run) {
+    start_timer (m_timer_prefix + this->name() + "::run");
+    timing_scope = std::make_unique<TimingScope>(m_timer_prefix + this->name() + "::run");
+  }
+  if (m_bytes_per_run<0) {
+    // All fields are set by now
+    m_bytes_per_run = compute_bytes_moved();
+  }
+  if (not m_concurrent_run && m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
   }
@@ -109,7 +119,7 @@ void AtmosphereProcess::run (const double dt) {
   // Complete tendency calculations (if any)
   compute_step_tendencies(dt);
 
-  if (m_params.get("enable_postcondition_checks", true)) {
+  if (not m_concurrent_run && m_params.get("enable_postcondition_checks", true)) {
     // Run 'post-condition' property checks stored in this AP
     run_postcondition_checks();
   }
@@ -119,7 +129,47 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
+  if (not m_concurrent_run) {
+    timing_scope->set_bytes(m_bytes_per_run*m_num_subcycles);
+    stop_timer (m_timer_prefix + this->name() + "::run");
+  }
+}
+
+long long AtmosphereProcess::compute_bytes_moved () const {
+  if (type()==AtmosphereProcessType::Group) {
+    // The bytes are counted by the stored atm procs
+    return 0;
+  }
+
+  auto field_bytes = [](const Field& f) -> long long {
+    const auto& fid = f.get_header().get_identifier();
+    return static_cast<long long>(fid.get_layout().size())*get_type_size(fid.data_type());
+  };
+  auto group_bytes = [&](const FieldGroup& g) -> long long {
+    if (g.m_info->m_bundled) {
+      return field_bytes(*g.m_bundle);
+    }
+    long long bytes = 0;
+    for (const auto& it : g.m_fields) {
+      bytes += field_bytes(*it.second);
+    }
+    return bytes;
+  };
+
+  long long bytes = 0;
+  for (const auto& f : m_fields_in) {
+    bytes += field_bytes(f);
+  }
+  for (const auto& f : m_fields_out) {
+    bytes += field_bytes(f);
+  }
+  for (const auto& g : m_groups_in) {
+    bytes += group_bytes(g);
+  }
+  for (const auto& g : m_groups_out) {
+    bytes += group_bytes(g);
+  }
+  return bytes;
 }
 
 void AtmosphereProcess::finalize (/* what inputs? */) {
@@ -540,6 +590,10 @@ void AtmosphereProcess::set_update_time_stamps (const bool do_update) {
   m_update_time_stamps = do_update;
 }
 
+void AtmosphereProcess::set_concurrent_run (const bool concurrent) {
+  m_concurrent_run = concurrent;
+}
+
 void AtmosphereProcess::update_time_stamps () {
   const auto& t = timestamp();
 
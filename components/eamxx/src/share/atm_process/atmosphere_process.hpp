@@ -126,6 +126,18 @@ public:
   //       or that of the output fields.
   void set_update_time_stamps (const bool do_update);
 
+  // If true, run may be called from a thread other than the main one, so it skips
+  // its GPTL timer and timing scope (which are not thread safe), as well as the
+  // pre/post-condition checks, which the caller is then responsible for. Timers
+  // inside run_impl should be TimerHandle's, which do nothing off the main thread.
+  // Atm proc groups forward this setting to their atm procs.
+  virtual void set_concurrent_run (const bool concurrent);
+  bool is_concurrent_run () const { return m_concurrent_run; }
+
+  // Whether run reads/writes files. Since scorpio is not thread safe, atm procs
+  // that do IO while running cannot be run concurrently with other atm procs.
+  virtual bool does_io_in_run () const { return false; }
+
   // These methods set fields/groups in the atm process. The fields/groups are stored
   // in a list (with some helpers maps that can be used to quickly retrieve them).
   // If derived class need additional bookkeping/checks, they can override the
@@ -470,6 +482,10 @@ private:
   FieldGroup& get_group_out_impl(const std::string& group_name, const std::string& grid_name) const;
   FieldGroup& get_group_out_impl(const std::string& group_name) const;
 
+  // Estimate the bytes moved by one call to run_impl, assuming each input
+  // field is read once, and each output field is written once.
+  long long compute_bytes_moved () const;
+
   // Compute/store data needed for this processes mass and energy conservation
   // check: dt, tolerance, current mass and energy value per column.
   void compute_column_conservation_checks_data (const int dt);
@@ -534,6 +550,9 @@ private:
   // The number of times this process needs to be subcycled
   int m_num_subcycles = 1;
 
+  // The bytes moved by one call to run_impl, used for timing (computed at first run)
+  long long m_bytes_per_run = -1;
+
   // This can be queried by derived classes, in case they need to know which
   // iteration of the subcycle this is
   int m_subcycle_iter;
@@ -541,6 +560,9 @@ private:
   // Whether we need to update time stamps at the end of the run method
   bool m_update_time_stamps = true;
 
+  // Whether run may be called from a thread other than the main one
+  bool m_concurrent_run = false;
+
   // Whether this atm proc should compute tendencies for any of its updated fields
   bool m_compute_proc_tendencies = false;
 
@@ -2,6 +2,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 
 #include <fstream>
+#include <algorithm>
 
 namespace scream {
 
@@ -61,6 +62,99 @@ create_dag(const group_type& atm_procs)
   update_unmet_deps ();
 }
 
+void AtmProcDAG::
+create_schedule (const group_type& atm_procs)
+{
+  const int num_procs = atm_procs.get_num_processes();
+  const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
+
+  // Gather the fields read/written by each atm proc. We identify a field by
+  // name and grid, so that different requests for the same field (e.g., with
+  // different layouts or pack sizes) are still flagged as conflicting.
+  auto key = [](const Field& f) {
+    const auto& fid = f.get_header().get_identifier();
+    return fid.name() + "@" + fid.get_grid_name();
+  };
+  auto add_group = [&](const FieldGroup& group, std::set<std::string>& keys) {
+    if (group.m_info->m_bundled) {
+      keys.insert(key(*group.m_bundle));
+    }
+    for (const auto& it : group.m_fields) {
+      keys.insert(key(*it.second));
+    }
+  };
+
+  std::vector<std::set<std::string>> reads(num_procs), writes(num_procs);
+  for (int i=0; i<num_procs; ++i) {
+    const auto proc = atm_procs.get_process(i);
+    for (const auto& f : proc->get_fields_in()) {
+      reads[i].insert(key(f));
+    }
+    for (const auto& f : proc->get_fields_out()) {
+      writes[i].insert(key(f));
+    }
+    for (const auto& g : proc->get_groups_in()) {
+      add_group(g,reads[i]);
+    }
+    for (const auto& g : proc->get_groups_out()) {
+      add_group(g,writes[i]);
+    }
+  }
+
+  auto intersect = [](const std::set<std::string>& lhs, const std::set<std::string>& rhs) {
+    for (const auto& k : lhs) {
+      if (rhs.count(k)==1) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  m_sched_deps.clear();
+  m_sched_deps.resize(num_procs);
+  m_sched_levels.clear();
+
+  std::vector<int> level(num_procs,0);
+  for (int i=0; i<num_procs; ++i) {
+    if (sequential) {
+      for (int j=0; j<i; ++j) {
+        if (intersect(reads[i],writes[j]) or
+            intersect(writes[i],reads[j]) or
+            intersect(writes[i],writes[j])) {
+          m_sched_deps[i].insert(j);
+          level[i] = std::max(level[i],level[j]+1);
+        }
+      }
+    }
+    if (level[i]>=static_cast<int>(m_sched_levels.size())) {
+      m_sched_levels.resize(level[i]+1);
+    }
+    m_sched_levels[level[i]].push_back(i);
+  }
+}
+
+double AtmProcDAG::
+critical_path_time (const std::vector<double>& times) const
+{
+  EKAT_REQUIRE_MSG (times.size()==m_sched_deps.size(),
+      "Error! Wrong number of atm procs times.\n"
+      "  - num atm procs in schedule: " + std::to_string(m_sched_deps.size()) + "\n"
+      "  - num times                : " + std::to_string(times.size()) + "\n");
+
+  // Deps always point to previous atm procs, so we can proceed in order
+  std::vector<double> finish(times.size(),0);
+  double crit_path = 0;
+  for (size_t i=0; i<times.size(); ++i) {
+    double start = 0;
+    for (auto j : m_sched_deps[i]) {
+      start = std::max(start,finish[j]);
+    }
+    finish[i] = start + times[i];
+    crit_path = std::max(crit_path,finish[i]);
+  }
+  return crit_path;
+}
+
 void AtmProcDAG::add_surface_coupling (const std::set<FieldIdentifier>& imports,
                                        const std::set<FieldIdentifier>& exports)
 {
@@ -343,10 +437,16 @@ add_nodes (const group_type& atm_procs)
   const int num_procs = atm_procs.get_num_processes();
   const bool sequential = (atm_procs.get_schedule_type()==ScheduleType::Sequential);
 
-  EKAT_REQUIRE_MSG (sequential, "Error! Parallel splitting dag not yet supported.\n");
+  // In parallel splitting, all the processes in the group see the state at the
+  // beginning of the group, so their inputs must be resolved against the providers
+  // *before* the group. The outputs of all processes are visible only after the group.
+  const auto providers_before = m_fid_to_last_provider;
+  auto providers_after = providers_before;
 
-  int id = m_nodes.size();
   for (int i=0; i<num_procs; ++i) {
+    if (not sequential) {
+      m_fid_to_last_provider = providers_before;
+    }
     const auto proc = atm_procs.get_process(i);
     const bool is_group = (proc->type()==AtmosphereProcessType::Group);
     if (is_group) {
@@ -360,8 +460,10 @@ add_nodes (const group_type& atm_procs)
     } else {
       // Create a node for the process
       // Node& node = m_nodes[proc->name()];
+      // Note: sub-groups may have added nodes, so get the id from the number of nodes
+      const int id = m_nodes.size();
       m_nodes.push_back(Node());
-      Node& node = m_nodes.back();;
+      Node& node = m_nodes.back();
       node.id = id;
       node.name = proc->name();
       m_unmet_deps[id].clear();
@@ -459,8 +561,21 @@ add_nodes (const group_type& atm_procs)
           }
         }
       }
-      ++id;
     }
+
+    if (not sequential) {
+      // Store the providers set by this process (or sub-group)
+      for (const auto& it : m_fid_to_last_provider) {
+        auto prev = providers_before.find(it.first);
+        if (prev==providers_before.end() or prev->second!=it.second) {
+          providers_after[it.first] = it.second;
+        }
+      }
+    }
+  }
+
+  if (not sequential) {
+    m_fid_to_last_provider = providers_after;
   }
 }
 
@@ -21,6 +21,28 @@ public:
 
   void write_dag (const std::string& fname, const int verbosity = VERB_MAX) const;
 
+  // Build an execution schedule for the atm procs of the input group (not recursively).
+  // In a sequential group, atm proc i must wait for atm proc j<i if any of these hold:
+  //  - i reads a field that j writes (read-after-write)
+  //  - i writes a field that j reads (write-after-read)
+  //  - i and j write the same field (write-after-write)
+  // In a parallel group, atm procs work on private copies of shared fields,
+  // so they never need to wait for each other.
+  // NOTE: this must be called *after* fields have been set in the group.
+  void create_schedule (const group_type& atm_procs);
+
+  // For each atm proc in the group, the atm procs it must wait for
+  const std::vector<std::set<int>>& schedule_deps () const { return m_sched_deps; }
+
+  // The atm procs, sorted in levels: an atm proc only depends on atm procs
+  // in previous levels, so atm procs in the same level can run concurrently.
+  const std::vector<std::vector<int>>& schedule_levels () const { return m_sched_levels; }
+
+  // Given the run time of each atm proc in the schedule, return the length
+  // of the longest chain of dependent atm procs, that is, the minimum time
+  // needed to run the group with an unlimited number of concurrent atm procs.
+  double critical_path_time (const std::vector<double>& times) const;
+
   bool has_unmet_dependencies () const { return m_has_unmet_deps; }
   const std::map<int,std::set<int>>& unmet_deps () const {
     return m_unmet_deps;
@@ -67,6 +89,10 @@ protected:
 
   // The nodes in the atm DAG
   std::vector<Node>               m_nodes;
+
+  // The execution schedule (see create_schedule)
+  std::vector<std::set<int>>      m_sched_deps;
+  std::vector<std::vector<int>>   m_sched_levels;
 };
 
 } // namespace scream
@@ -1,5 +1,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
+#include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_thread_pool.hpp"
 
 #include "share/property_checks/field_nan_check.hpp"
 
@@ -7,9 +9,35 @@
 #include "ekat/util/ekat_string_utils.hpp"
 
 #include <memory>
+#include <algorithm>
+#include <chrono>
 
 namespace scream {
 
+namespace {
+
+// A copy of the group, with its own memory. If the group is bundled, the fields
+// in the copy are subfields of the copy of the bundle.
+FieldGroup clone_group (const FieldGroup& group) {
+  FieldGroup copy = group;
+  if (group.m_bundle) {
+    copy.m_bundle = std::make_shared<Field>(group.m_bundle->clone());
+    for (auto& it : copy.m_fields) {
+      const auto& fid = it.second->get_header().get_identifier();
+      const int idx = group.m_info->m_subview_idx.at(it.first);
+      it.second = std::make_shared<Field>(copy.m_bundle->subfield(fid.name(),fid.get_units(),
+                                                                  group.m_info->m_subview_dim,idx));
+    }
+  } else {
+    for (auto& it : copy.m_fields) {
+      it.second = std::make_shared<Field>(it.second->clone());
+    }
+  }
+  return copy;
+}
+
+} // anonymous namespace
+
 AtmosphereProcessGroup::
 AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -27,7 +55,6 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -36,6 +63,9 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
     m_group_schedule_type = ScheduleType::Sequential;
   }
 
+  m_concurrent_dispatch  = m_params.get<bool>("concurrent_dispatch",false);
+  m_report_critical_path = m_params.get<bool>("report_critical_path",false);
+
   // Create the individual atmosphere processes
   m_group_name = params.name();
 
@@ -49,24 +79,17 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (int i=0; i<m_group_size; ++i) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // All processes use the same comm of this APG. In parallel scheduling,
+    // processes are split in "state space" rather than across ranks: each
+    // process works on its own copy of the shared fields (see set_computed_field_impl).
+    // With concurrent dispatch, each process gets a duplicate of the comm, so that
+    // collectives issued at the same time by different processes cannot mix up.
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      ekat::error::runtime_abort("Error! Parallel schedule type not yet implemented.\n");
+    if (m_concurrent_dispatch) {
+      MPI_Comm dup_comm;
+      MPI_Comm_dup(m_comm.mpi_comm(),&dup_comm);
+      m_dup_comms.push_back(dup_comm);
+      proc_comm = ekat::Comm(dup_comm);
     }
 
     // Check if the i-th entry is a "named" atm proc or a group defined on the fly.
@@ -349,6 +372,51 @@ void AtmosphereProcessGroup::add_postcondition_nan_checks () const {
 }
 
 void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    // Processes may read their inputs during initialization
+    scatter_shared_fields();
+  }
+
+  if (m_concurrent_dispatch or m_report_critical_path) {
+    // All fields are set by now, so we can find the conflicts between atm procs
+    m_schedule = std::make_shared<AtmProcDAG>();
+    m_schedule->create_schedule(*this);
+    m_run_times.assign(m_group_size,0);
+
+    const auto& levels = m_schedule->schedule_levels();
+    m_atm_logger->info("[EAMxx::" + name() + "] execution schedule ("
+                       + std::to_string(levels.size()) + " levels):");
+    for (size_t l=0; l<levels.size(); ++l) {
+      std::vector<std::string> names;
+      for (auto i : levels[l]) {
+        names.push_back(m_atm_processes[i]->name());
+      }
+      m_atm_logger->info("  level " + std::to_string(l) + ": " + ekat::join(names,", "));
+    }
+  }
+
+  // Atm procs sharing a level with other atm procs run off the main thread
+  m_dispatched.assign(m_group_size,false);
+  if (m_concurrent_dispatch) {
+    for (const auto& level : m_schedule->schedule_levels()) {
+      for (auto i : level) {
+        m_dispatched[i] = level.size()>1;
+      }
+    }
+  }
+  set_concurrent_run(is_concurrent_run());
+
+  if (std::count(m_dispatched.begin(),m_dispatched.end(),true)>0) {
+    check_concurrent_dispatch();
+
+    // The helper threads are created once, and reused at every run
+    size_t max_level_size = 0;
+    for (const auto& level : m_schedule->schedule_levels()) {
+      max_level_size = std::max(max_level_size,level.size());
+    }
+    m_workers = std::make_shared<ThreadPool>(max_level_size-1);
+  }
+
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->initialize(timestamp(),run_type);
 #ifdef SCREAM_HAS_MEMORY_USAGE
@@ -373,29 +441,196 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   auto ts = timestamp();
   ts += dt;
 
+  run_atm_procs(dt,"run_sequential");
+}
+
+void AtmosphereProcessGroup::run_parallel (const double dt) {
+  // All processes start from the state at the beginning of the group
+  scatter_shared_fields();
+
+  // Processes work on their own copies of the shared fields, so they could run in
+  // any order, or concurrently. They run one after the other, unless concurrent_dispatch=true
+  run_atm_procs(dt,"run_parallel");
+
+  // Sum the increments of all processes
+  gather_shared_fields();
+}
+
+void AtmosphereProcessGroup::
+run_atm_procs (const double dt, const std::string& caller) {
   // The stored atm procs should update the timestamp if both
   //  - this is the last subcycle iteration
   //  - nobody from outside told this APG to not update timestamps
   const bool do_update = do_update_time_stamp() &&
                       (get_subcycle_iter()==get_num_subcycles()-1);
-  for (auto atm_proc : m_atm_processes) {
+
+  // Timing each atm proc requires a fence, so only do it if requested. Atm procs
+  // running concurrently do not need one, since kernels run synchronously on host
+  // (see check_concurrent_dispatch), and a fence would wait for the other atm procs.
+  const bool timed = m_report_critical_path;
+  auto run_proc = [&](const int i) {
+    const auto& atm_proc = m_atm_processes[i];
     atm_proc->set_update_time_stamps(do_update);
-    // Run the process
-    atm_proc->run(dt);
+    if (timed) {
+      const auto start = std::chrono::steady_clock::now();
+      atm_proc->run(dt);
+      if (not m_dispatched[i]) {
+        Kokkos::fence();
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      m_run_times[i] = elapsed.count();
+    } else {
+      atm_proc->run(dt);
+    }
+  };
+
+  // Atm procs that run concurrently skip their property checks (see set_concurrent_run),
+  // so we run them here, before and after the atm procs run.
+  auto checks_enabled = [&](const int i, const std::string& name) {
+    const auto& params = m_atm_processes[i]->get_params();
+    return not params.isParameter(name) || params.get<bool>(name);
+  };
+  auto run_precondition_checks = [&](const int i) {
+    if (m_atm_processes[i]->is_concurrent_run() && checks_enabled(i,"enable_precondition_checks")) {
+      m_atm_processes[i]->run_precondition_checks();
+    }
+  };
+  auto run_postcondition_checks = [&](const int i) {
+    if (m_atm_processes[i]->is_concurrent_run() && checks_enabled(i,"enable_postcondition_checks")) {
+      m_atm_processes[i]->run_postcondition_checks();
+    }
+  };
+
+  if (m_concurrent_dispatch) {
+    for (const auto& level : m_schedule->schedule_levels()) {
+      for (auto i : level) {
+        run_precondition_checks(i);
+      }
+
+      // Run the first atm proc of the level on this thread, and the others on
+      // the helper threads. Exceptions are rethrown once all atm procs are done.
+      if (level.size()>1) {
+        std::vector<ThreadPool::task_type> tasks;
+        for (auto i : level) {
+          tasks.push_back([&,i]() { run_proc(i); });
+        }
+        m_workers->run(tasks);
+      } else {
+        run_proc(level[0]);
+      }
+
+      for (auto i : level) {
+        run_postcondition_checks(i);
+      }
+    }
+  } else {
+    for (int i=0; i<m_group_size; ++i) {
+      run_precondition_checks(i);
+      run_proc(i);
+      run_postcondition_checks(i);
 #ifdef SCREAM_HAS_MEMORY_USAGE
-    long long my_mem_usage = get_mem_usage(MB);
-    long long max_mem_usage;
-    m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
-    m_atm_logger->debug("[EAMxx::run_sequential::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
+      long long my_mem_usage = get_mem_usage(MB);
+      long long max_mem_usage;
+      m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
+      m_atm_logger->debug("[EAMxx::"+caller+"::"+m_atm_processes[i]->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
+    }
+  }
+
+  if (timed) {
+    report_critical_path();
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::check_concurrent_dispatch () const {
+  // Atm procs running concurrently issue MPI calls from different threads
+  int thread_level;
+  MPI_Query_thread(&thread_level);
+  EKAT_REQUIRE_MSG (thread_level==MPI_THREAD_MULTIPLE,
+      "Error! Concurrent dispatch requires MPI to be initialized with MPI_THREAD_MULTIPLE.\n"
+      "  - Atm proc group: " + name() + "\n");
+
+#ifdef EAMXX_ENABLE_GPU
+  // Atm procs launch their kernels on the default instance, so on device they would
+  // be serialized anyway, and fencing one atm proc would wait for all the others
+  EKAT_ERROR_MSG ("Error! Concurrent dispatch is not supported in GPU builds.\n"
+      "  - Atm proc group: " + name() + "\n");
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+  // The OpenMP backend does not support launching kernels from several host threads
+  EKAT_ERROR_MSG ("Error! Concurrent dispatch is not supported with the Kokkos OpenMP backend.\n"
+      "  - Atm proc group: " + name() + "\n");
+#endif
+
+  // Scorpio is not thread safe
+  for (int i=0; i<m_group_size; ++i) {
+    EKAT_REQUIRE_MSG (not m_dispatched[i] or not m_atm_processes[i]->does_io_in_run(),
+        "Error! An atm proc that reads/writes files while running cannot be run concurrently\n"
+        "       with other atm procs, since scorpio is not thread safe.\n"
+        "  - Atm proc group: " + name() + "\n"
+        "  - Atm proc      : " + m_atm_processes[i]->name() + "\n"
+        " Move the atm proc to a different group, or disable 'concurrent_dispatch'.\n");
+  }
+}
+
+void AtmosphereProcessGroup::report_critical_path () {
+  // Times are reduced across ranks only at finalize, to avoid a collective every step
+  double serial_time = 0;
+  for (auto t : m_run_times) {
+    serial_time += t;
+  }
+  const double critical_path = m_schedule->critical_path_time(m_run_times);
+
+  m_tot_serial_time   += serial_time;
+  m_tot_critical_path += critical_path;
+  ++m_num_timed_runs;
+
+  m_atm_logger->debug("[EAMxx::" + name() + "] serial time: " + std::to_string(serial_time)
+                      + "s, critical path: " + std::to_string(critical_path) + "s");
+}
+
+void AtmosphereProcessGroup::scatter_shared_fields () {
+  for (auto& sf : m_shared_fields) {
+    const auto& ts = sf.field.get_header().get_tracking().get_time_stamp();
+    for (auto& copy : sf.copies) {
+      copy.deep_copy(sf.field);
+      copy.get_header().get_tracking().update_time_stamp(ts);
+    }
+  }
+}
+
+void AtmosphereProcessGroup::gather_shared_fields () {
+  // Each process computed f_i = f + delta_i. We want f + sum_i delta_i, which
+  // can be computed as sum_i f_i - (N-1)*f, where N is the number of
+  // processes that compute f.
+  for (auto& sf : m_shared_fields) {
+    int num_computed = 0;
+    for (size_t i=0; i<sf.copies.size(); ++i) {
+      if (not sf.computed[i]) {
+        continue;
+      }
+      if (num_computed==0) {
+        const int n = std::count(sf.computed.begin(),sf.computed.end(),true);
+        sf.field.update(sf.copies[i],Real(1),Real(1-n));
+      } else {
+        sf.field.update(sf.copies[i],Real(1),Real(1));
+      }
+      ++num_computed;
+    }
+  }
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
+  if (m_report_critical_path) {
+    // Use the slowest rank, since that is what determines the run time
+    double times[2] = {m_tot_serial_time, m_tot_critical_path};
+    double max_times[2];
+    m_comm.all_reduce(times,max_times,2,MPI_MAX);
+    const double frac = max_times[0]>0 ? max_times[1]/max_times[0] : 0;
+    m_atm_logger->info("[EAMxx::" + name() + "] critical path: " + std::to_string(max_times[1])
+                       + "s out of " + std::to_string(max_times[0]) + "s of serial time ("
+                       + std::to_string(100*frac) + "%), over " + std::to_string(m_num_timed_runs) + " runs");
+  }
   for (auto atm_proc : m_atm_processes) {
     atm_proc->finalize(/* what inputs? */);
 #ifdef SCREAM_HAS_MEMORY_USAGE
@@ -405,6 +640,31 @@ void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
     m_atm_logger->debug("[EAMxx::finalize::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
   }
+  // Join the helper threads
+  m_workers = nullptr;
+  for (auto& c : m_dup_comms) {
+    MPI_Comm_free(&c);
+  }
+  m_dup_comms.clear();
+}
+
+bool AtmosphereProcessGroup::does_io_in_run () const {
+  for (const auto& atm_proc : m_atm_processes) {
+    if (atm_proc->does_io_in_run()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void AtmosphereProcessGroup::set_concurrent_run (const bool concurrent) {
+  AtmosphereProcess::set_concurrent_run(concurrent);
+
+  // If this group runs off the main thread, so do all its atm procs
+  for (int i=0; i<m_group_size; ++i) {
+    const bool dispatched = i<static_cast<int>(m_dispatched.size()) && m_dispatched[i];
+    m_atm_processes[i]->set_concurrent_run(concurrent || dispatched);
+  }
 }
 
 void AtmosphereProcessGroup::
@@ -413,6 +673,7 @@ set_required_field (const Field& f) {
     // In parallel splitting, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -481,6 +742,7 @@ set_required_group (const FieldGroup& group) {
     // In parallel splitting, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
@@ -556,6 +818,11 @@ endloop:
 void AtmosphereProcessGroup::
 set_required_group_impl (const FieldGroup& group)
 {
+  if (m_group_schedule_type==ScheduleType::Parallel and
+      has_computed_group(group.m_info->m_group_name,group.grid_name())) {
+    // This group will be set in the processes during set_computed_group_impl
+    return;
+  }
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_required_group(group.m_info->m_group_name,group.grid_name())) {
       atm_proc->set_required_group(group);
@@ -566,6 +833,87 @@ set_required_group_impl (const FieldGroup& group)
 void AtmosphereProcessGroup::
 set_computed_group_impl (const FieldGroup& group)
 {
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    // Like shared fields, but the atm procs may use the group as a whole, or any
+    // of its fields individually. Each atm proc gets its own copy of the group,
+    // and its fields are taken from that copy, so that they are consistent.
+    const auto& gname = group.m_info->m_group_name;
+    const auto& grid  = group.grid_name();
+    std::vector<int>  procs;
+    std::vector<bool> computed;
+    for (int iproc=0; iproc<m_group_size; ++iproc) {
+      const auto& atm_proc = m_atm_processes[iproc];
+      bool writes = atm_proc->has_computed_group(gname,grid);
+      bool reads  = atm_proc->has_required_group(gname,grid);
+      for (const auto& fn : group.m_info->m_fields_names) {
+        const bool uses_f = atm_proc->has_computed_field(fn,grid) or atm_proc->has_required_field(fn,grid);
+        EKAT_REQUIRE_MSG (not uses_f or group.m_fields.count(fn)==1,
+            "Error! An atm proc uses a field of a group whose fields were not allocated individually.\n"
+            "  - atm proc group: " + name() + "\n"
+            "  - atm proc      : " + atm_proc->name() + "\n"
+            "  - group name    : " + gname + "\n"
+            "  - field name    : " + fn + "\n");
+        writes |= atm_proc->has_computed_field(fn,grid);
+        reads  |= atm_proc->has_required_field(fn,grid);
+      }
+      if (writes or reads) {
+        procs.push_back(iproc);
+        computed.push_back(writes);
+      }
+    }
+
+    // If only one process uses this group, it can work directly on it
+    const bool shared = procs.size()>1;
+    std::vector<FieldGroup> copies;
+    for (auto iproc : procs) {
+      auto atm_proc = m_atm_processes[iproc];
+      auto g_proc = shared ? clone_group(group) : group;
+      if (atm_proc->has_computed_group(gname,grid)) {
+        atm_proc->set_computed_group(g_proc);
+      }
+      if (atm_proc->has_required_group(gname,grid)) {
+        atm_proc->set_required_group(g_proc.get_const());
+      }
+      for (const auto& it : g_proc.m_fields) {
+        const auto& f = *it.second;
+        if (atm_proc->has_computed_field(f.get_header().get_identifier())) {
+          atm_proc->set_computed_field(f);
+        }
+        if (atm_proc->has_required_field(f.get_header().get_identifier())) {
+          atm_proc->set_required_field(f.get_const());
+        }
+      }
+      copies.push_back(g_proc);
+    }
+
+    if (shared) {
+      // The increments are summed over the whole bundle, if there is one
+      std::vector<std::pair<Field,std::vector<Field>>> fields;
+      if (group.m_bundle) {
+        fields.emplace_back(*group.m_bundle,std::vector<Field>());
+        for (const auto& c : copies) {
+          fields.back().second.push_back(*c.m_bundle);
+        }
+      } else {
+        for (const auto& it : group.m_fields) {
+          fields.emplace_back(*it.second,std::vector<Field>());
+          for (const auto& c : copies) {
+            fields.back().second.push_back(*c.m_fields.at(it.first));
+          }
+        }
+      }
+      for (const auto& it : fields) {
+        SharedField sf;
+        sf.field    = it.first;
+        sf.procs    = procs;
+        sf.copies   = it.second;
+        sf.computed = computed;
+        m_shared_fields.push_back(sf);
+      }
+    }
+    return;
+  }
+
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_computed_group(group.m_info->m_group_name,group.grid_name())) {
       atm_proc->set_computed_group(group);
@@ -582,6 +930,12 @@ set_computed_group_impl (const FieldGroup& group)
 
 void AtmosphereProcessGroup::set_required_field_impl (const Field& f) {
   const auto& fid = f.get_header().get_identifier();
+  if (m_group_schedule_type==ScheduleType::Parallel and
+      (has_computed_field(fid) or not computed_group_of(f).empty())) {
+    // This field will be set in the processes during set_computed_field_impl
+    // or set_computed_group_impl
+    return;
+  }
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_required_field(fid)) {
       atm_proc->set_required_field(f);
@@ -591,6 +945,53 @@ void AtmosphereProcessGroup::set_required_field_impl (const Field& f) {
 
 void AtmosphereProcessGroup::set_computed_field_impl (const Field& f) {
   const auto& fid = f.get_header().get_identifier();
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    if (not computed_group_of(f).empty()) {
+      // This field will be set in the processes during set_computed_group_impl
+      return;
+    }
+
+    SharedField sf;
+    sf.field = f;
+    int num_group_readers = 0;
+    for (int iproc=0; iproc<m_group_size; ++iproc) {
+      const auto& atm_proc = m_atm_processes[iproc];
+      const bool computed = atm_proc->has_computed_field(fid);
+      if (computed or atm_proc->has_required_field(fid)) {
+        sf.procs.push_back(iproc);
+        sf.computed.push_back(computed);
+      } else {
+        // Atm procs reading f through a group use the group input, so they
+        // need no copy, but f cannot be updated in place while they run
+        for (const auto& it : f.get_header().get_tracking().get_groups_info()) {
+          if (atm_proc->has_required_group(it.lock()->m_group_name,fid.get_grid_name())) {
+            ++num_group_readers;
+            break;
+          }
+        }
+      }
+    }
+
+    const bool shared = sf.procs.size()+num_group_readers>1;
+    for (size_t i=0; i<sf.procs.size(); ++i) {
+      auto atm_proc = m_atm_processes[sf.procs[i]];
+      // If only one process uses this field, it can work directly on f
+      auto f_proc = shared ? f.clone() : f;
+      if (sf.computed[i]) {
+        atm_proc->set_computed_field(f_proc);
+      }
+      if (atm_proc->has_required_field(fid)) {
+        atm_proc->set_required_field(f_proc.get_const());
+      }
+      if (shared) {
+        sf.copies.push_back(f_proc);
+      }
+    }
+    if (shared) {
+      m_shared_fields.push_back(sf);
+    }
+    return;
+  }
   for (auto atm_proc : m_atm_processes) {
     if (atm_proc->has_computed_field(fid)) {
       atm_proc->set_computed_field(f);
@@ -605,6 +1006,25 @@ void AtmosphereProcessGroup::set_computed_field_impl (const Field& f) {
   }
 }
 
+std::string AtmosphereProcessGroup::computed_group_of (const Field& f) const {
+  // The increments of the group copies are summed group by group, so a field
+  // cannot be in two of them (it would get the increments of one group only)
+  const auto& fid = f.get_header().get_identifier();
+  std::vector<std::string> groups;
+  for (const auto& it : f.get_header().get_tracking().get_groups_info()) {
+    const auto& gname = it.lock()->m_group_name;
+    if (has_computed_group(gname,fid.get_grid_name())) {
+      groups.push_back(gname);
+    }
+  }
+  EKAT_REQUIRE_MSG (groups.size()<=1,
+      "Error! In parallel scheduling, a field can belong to only one computed group.\n"
+      "  - atm proc group: " + name() + "\n"
+      "  - field name    : " + fid.name() + "\n"
+      "  - groups        : " + ekat::join(groups,", ") + "\n");
+  return groups.empty() ? "" : groups.front();
+}
+
 void AtmosphereProcessGroup::
 process_required_group (const GroupRequest& req) {
   if (m_group_schedule_type==ScheduleType::Sequential) {
@@ -648,21 +1068,103 @@ process_required_field (const FieldRequest& req) {
   }
 }
 
-size_t AtmosphereProcessGroup::requested_buffer_size_in_bytes () const
+int AtmosphereProcessGroup::num_buffer_slots () const
 {
-  size_t buf_size = 0;
-  for (const auto& proc : m_atm_processes) {
-    buf_size = std::max(buf_size,proc->requested_buffer_size_in_bytes());
+  auto proc_slots = [&](const int i) {
+    auto group = std::dynamic_pointer_cast<const AtmosphereProcessGroup>(m_atm_processes[i]);
+    return group ? group->num_buffer_slots() : 1;
+  };
+
+  int num_slots = 0;
+  if (m_concurrent_dispatch) {
+    AtmProcDAG dag;
+    dag.create_schedule(*this);
+    for (const auto& level : dag.schedule_levels()) {
+      int level_slots = 1;
+      for (auto i : level) {
+        level_slots = std::max(level_slots,proc_slots(i));
+      }
+      num_slots += level_slots;
+    }
+  } else {
+    for (int i=0; i<m_group_size; ++i) {
+      num_slots += proc_slots(i);
+    }
   }
+  return num_slots;
+}
 
-  return buf_size;
+int AtmosphereProcessGroup::
+request_buffers (ATMBufferManager& buffer_manager, const int first_slot, const int last_slot) const
+{
+  // Request the buffer of the i-th atm proc for the slots [first,last]. If last<0,
+  // the atm proc runs alone, and a nested group can use its own slots.
+  auto request_proc = [&](const int i, const int first, const int last) {
+    const auto& atm_proc = m_atm_processes[i];
+    auto group = std::dynamic_pointer_cast<const AtmosphereProcessGroup>(atm_proc);
+    if (group) {
+      group->request_buffers(buffer_manager,first,last);
+    } else {
+      buffer_manager.request_bytes(buffer_request_name(i),
+                                   atm_proc->requested_buffer_size_in_bytes(),
+                                   first,last<0 ? first : last);
+    }
+  };
+  auto proc_slots = [&](const int i) {
+    auto group = std::dynamic_pointer_cast<const AtmosphereProcessGroup>(m_atm_processes[i]);
+    return group ? group->num_buffer_slots() : 1;
+  };
+
+  if (last_slot>=0) {
+    // This group runs concurrently with other atm procs, which may run at
+    // the same time as any of our atm procs: keep all of them live throughout
+    for (int i=0; i<m_group_size; ++i) {
+      request_proc(i,first_slot,last_slot);
+    }
+    return last_slot+1;
+  }
+
+  int slot = first_slot;
+  if (m_concurrent_dispatch) {
+    // Atm procs in the same level of the schedule start together, and the next
+    // level starts once they are all done. Each atm proc in the level may run
+    // at the same time as any atm proc of a nested group in the same level, so
+    // all of them are live until the end of the level.
+    AtmProcDAG dag;
+    dag.create_schedule(*this);
+    for (const auto& level : dag.schedule_levels()) {
+      int end = slot+1;
+      for (auto i : level) {
+        end = std::max(end,slot+proc_slots(i));
+      }
+      for (auto i : level) {
+        request_proc(i,slot,level.size()>1 ? end-1 : -1);
+      }
+      slot = end;
+    }
+  } else {
+    for (int i=0; i<m_group_size; ++i) {
+      request_proc(i,slot,-1);
+      slot += proc_slots(i);
+    }
+  }
+  return slot;
 }
 
 void AtmosphereProcessGroup::
 init_buffers(const ATMBufferManager& buffer_manager) {
-  for (auto& atm_proc : m_atm_processes) {
-    atm_proc->init_buffers(buffer_manager);
+  for (int i=0; i<m_group_size; ++i) {
+    const auto& atm_proc = m_atm_processes[i];
+    if (atm_proc->type()==AtmosphereProcessType::Group) {
+      atm_proc->init_buffers(buffer_manager);
+    } else {
+      atm_proc->init_buffers(buffer_manager.get_allocation(buffer_request_name(i)));
+    }
   }
 }
 
+std::string AtmosphereProcessGroup::buffer_request_name (const int i) const {
+  return name() + "::" + m_atm_processes[i]->name();
+}
+
 } // namespace scream
@@ -13,6 +13,9 @@
 namespace scream
 {
 
+class AtmProcDAG;
+class ThreadPool;
+
 /*
  *  A class representing a group of atmosphere processes as a single process.
  *
@@ -24,6 +27,37 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling, all the atm procs in the group compute their updates
+ *  starting from the same input state, and the resulting increments are summed.
+ *  Fields that are used by 2+ atm procs (and computed by at least one of them)
+ *  are "shared": each atm proc gets its own copy, which is reset to the group
+ *  input before running, so that the atm procs are independent of each other.
+ *  Fields that are used by only one atm proc are passed through, with no copy.
+ *  The same goes for computed groups: each atm proc that uses the group, or any
+ *  of its fields, gets its own copy of the group (of the bundle, if bundled), and
+ *  its fields are subfields of that copy. E.g., all physics atm procs can update
+ *  the tracers in the same parallel group. A field can be in one computed group only.
+ *  Parallel scheduling only sets what each atm proc sees: the atm procs still run
+ *  one after the other, unless 'concurrent_dispatch' is also true (see below).
+ *
+ *  Independently of the schedule type, the group can build an execution schedule
+ *  from the fields read/written by its atm procs (see AtmProcDAG::create_schedule).
+ *  If 'concurrent_dispatch' is true, atm procs with no read/write conflicts are
+ *  run concurrently on a pool of host threads (created at initialization), each
+ *  with its own slice of the memory buffer and its own duplicate of the group comm
+ *  (so that MPI must be initialized with MPI_THREAD_MULTIPLE). Atm procs that run
+ *  off the main thread skip their GPTL timer and timing scope, as well as any
+ *  TimerHandle inside run_impl, and their property checks are run by the group
+ *  on the main thread, before and after each level of the schedule. At initialization,
+ *  the group errors out if an atm proc that does IO while running would be dispatched
+ *  concurrently (scorpio is not thread safe), in GPU builds (atm procs launch on the
+ *  default execution space instance, so their kernels would not overlap), or if Kokkos
+ *  uses the OpenMP backend, which does not support launching kernels from several
+ *  host threads. If 'report_critical_path' is true, the group times its atm procs
+ *  (with a fence, except for atm procs running concurrently), and reports the time
+ *  of the longest chain of dependent atm procs (the critical path) vs the total
+ *  serial time.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -61,11 +95,26 @@ public:
 
   ScheduleType get_schedule_type () const { return m_group_schedule_type; }
 
-  // Computes total number of bytes needed for local variables
-  size_t requested_buffer_size_in_bytes () const;
+  // Forward the setting to the stored atm procs
+  void set_concurrent_run (const bool concurrent);
+
+  // True if any of the stored atm procs does IO while running
+  bool does_io_in_run () const;
 
-  // Set local variables using memory provided by
-  // the ATMBufferManager
+  // Register one named request per atm proc in the buffer manager, with a lifetime
+  // given by the slots during which the atm proc may run. Atm procs run one after the
+  // other get consecutive slots, while atm procs in the same level of a concurrent
+  // schedule (and all the atm procs of nested groups in that level) are live from
+  // the first to the last slot of the level. If last_slot>=0, all the atm procs of
+  // this group are live in [first_slot,last_slot]. Returns the first slot after this group.
+  int request_buffers (ATMBufferManager& buffer_manager, const int first_slot = 0,
+                       const int last_slot = -1) const;
+
+  // The number of slots that request_buffers uses for this group
+  int num_buffer_slots () const;
+
+  // Set local variables using memory provided by the ATMBufferManager.
+  // NOTE: request_buffers must have been called on the buffer manager
   void init_buffers(const ATMBufferManager& buffer_manager);
 
   // The APG class needs to perform special checks before establishing whether
@@ -110,6 +159,27 @@ protected:
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
 
+  // Run all the atm procs, either one after the other, or following the schedule
+  void run_atm_procs (const double dt, const std::string& caller);
+
+  // Check that the atm procs of this group can be run concurrently (see class description)
+  void check_concurrent_dispatch () const;
+
+  // Log the serial vs critical-path time of the last run
+  void report_critical_path ();
+
+  // The name of the buffer request of the i-th atm proc
+  std::string buffer_request_name (const int i) const;
+
+  // Parallel scheduling only: reset the copies of the shared fields to the
+  // group input, and accumulate the atm procs increments in the group output
+  void scatter_shared_fields ();
+  void gather_shared_fields ();
+
+  // Parallel scheduling only: the name of the computed group that f belongs to
+  // (empty if none). Such fields are set in the atm procs with their group.
+  std::string computed_group_of (const Field& f) const;
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
   void set_computed_field_impl (const Field& f);
@@ -128,6 +198,31 @@ protected:
 
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
+
+  // Parallel scheduling only: the fields used by 2+ atm procs, with the
+  // copies handed to each of the atm procs that use them. For shared groups,
+  // these are the group bundle (or each of its fields, if not bundled)
+  struct SharedField {
+    Field               field;
+    std::vector<int>    procs;
+    std::vector<Field>  copies;
+    std::vector<bool>   computed;
+  };
+  std::vector<SharedField>  m_shared_fields;
+
+  // Schedule based on read/write conflicts between atm procs (see class description)
+  bool                          m_concurrent_dispatch;
+  bool                          m_report_critical_path;
+  std::shared_ptr<AtmProcDAG>   m_schedule;
+  std::vector<bool>             m_dispatched;
+  std::shared_ptr<ThreadPool>   m_workers;
+  std::vector<MPI_Comm>         m_dup_comms;
+
+  // Timing of the atm procs, used to report the critical path
+  std::vector<double>           m_run_times;
+  double                        m_tot_serial_time    = 0;
+  double                        m_tot_critical_path  = 0;
+  int                           m_num_timed_runs     = 0;
 };
 
 } // namespace scream
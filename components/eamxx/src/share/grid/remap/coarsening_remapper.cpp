@@ -377,43 +377,20 @@ void CoarseningRemapper::do_remap_fwd ()
 
   // TODO: Add check that if there are mask values they are either 1's or 0's for unmasked/masked.
 
-  // Loop over each field
-  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
-  for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the src field, and y is the overlapped tgt field.
-    const auto& f_src    = m_src_fields[i];
-    const auto& f_ov_tgt = m_ov_tgt_fields[i];
-
-    const int mask_idx = m_field_idx_to_mask_idx[i];
-    if (mask_idx>0) {
-      // Pass the mask to the local_mat_vec routine
-      auto mask = m_src_fields[mask_idx];
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,&mask);
-      } else {
-        local_mat_vec<1>(f_src,f_ov_tgt,&mask);
-      }
-    } else {
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt);
-      } else {
-        local_mat_vec<1>(f_src,f_ov_tgt);
-      }
-    }
-  }
+  // Pipeline the remap, to hide as much communication latency as possible:
+  //  - compute the rows that are owned by remote PIDs, then pack and send them;
+  //  - compute the rank-local rows while the messages are in flight;
+  //  - wait for the remote contributions, and unpack them together with the local ones.
+  // Recall that in these y=Ax products, x is the src field, and y is the overlapped tgt field.
+  const int nrows = m_ov_tgt_grid->get_num_local_dofs();
+  run_local_mat_vec (0,m_num_remote_rows);
 
   // Pack, then fire off the sends
   pack_and_send ();
 
+  // Compute the rank-local rows
+  run_local_mat_vec (m_num_remote_rows,nrows);
+
   // Wait for all data to be received, then unpack
   recv_and_unpack ();
 
@@ -427,6 +404,7 @@ void CoarseningRemapper::do_remap_fwd ()
 
   // Rescale any fields that had the mask applied.
   if (m_track_mask) {
+    constexpr auto can_pack = SCREAM_PACK_SIZE>1;
     for (int i=0; i<m_num_fields; ++i) {
       const auto& f_tgt = m_tgt_fields[i];
       const int mask_idx = m_field_idx_to_mask_idx[i];
@@ -444,6 +422,35 @@ void CoarseningRemapper::do_remap_fwd ()
   }
 }
 
+void CoarseningRemapper::
+run_local_mat_vec (const int row_beg, const int row_end) const
+{
+  if (row_beg==row_end) {
+    return;
+  }
+
+  // Loop over each field
+  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& f_src    = m_src_fields[i];
+    const auto& f_ov_tgt = m_ov_tgt_fields[i];
+
+    // Pass the mask (if any) to the local_mat_vec routine
+    const int mask_idx = m_field_idx_to_mask_idx.at(i);
+    const Field* mask = mask_idx>0 ? &m_src_fields[mask_idx] : nullptr;
+
+    // Dispatch kernel with the largest possible pack size
+    const auto& src_ap = f_src.get_header().get_alloc_properties();
+    const auto& ov_tgt_ap = f_ov_tgt.get_header().get_alloc_properties();
+    if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
+                    ov_tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
+      local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov_tgt,row_beg,row_end,mask);
+    } else {
+      local_mat_vec<1>(f_src,f_ov_tgt,row_beg,row_end,mask);
+    }
+  }
+}
+
 template<int PackSize>
 void CoarseningRemapper::
 rescale_masked_fields (const Field& x, const Field& mask) const
@@ -536,7 +543,9 @@ rescale_masked_fields (const Field& x, const Field& mask) const
 
 template<int PackSize>
 void CoarseningRemapper::
-local_mat_vec (const Field& x, const Field& y, const Field* mask) const
+local_mat_vec (const Field& x, const Field& y,
+               const int row_beg, const int row_end,
+               const Field* mask) const
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
@@ -546,7 +555,8 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
 
   const auto& src_layout = x.get_header().get_identifier().get_layout();
   const int rank = src_layout.rank();
-  const int nrows = m_ov_tgt_grid->get_num_local_dofs();
+  const int nrows = row_end - row_beg;
+  auto rows = m_ov_row_order;
   auto row_offsets = m_row_offsets;
   auto col_lids = m_col_lids;
   auto weights = m_weights;
@@ -562,8 +572,9 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       if (mask != nullptr) {
         mask_view = mask->get_view<Real*>();
       }
-      Kokkos::parallel_for(RangePolicy(0,nrows),
-                           KOKKOS_LAMBDA(const int& row) {
+      Kokkos::parallel_for(RangePolicy(row_beg,row_end),
+                           KOKKOS_LAMBDA(const int& i) {
+        const auto row = rows(i);
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
         if (mask != nullptr) {
@@ -592,7 +603,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       auto policy = ESU::get_default_team_policy(nrows,dim1);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = rows(row_beg+team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -627,7 +638,7 @@ local_mat_vec (const Field& x, const Field& y, const Field* mask) const
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = rows(row_beg+team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -667,6 +678,7 @@ void CoarseningRemapper::pack_and_send ()
   const auto pid_lid_start = m_send_pid_lids_start;
   const auto lids_pids = m_send_lids_pids;
   const auto buf = m_send_buffer;
+  const int my_pid = m_comm.rank();
 
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
     const auto& f  = m_ov_tgt_fields[ifield];
@@ -682,6 +694,10 @@ void CoarseningRemapper::pack_and_send ()
                              KOKKOS_LAMBDA(const int& i){
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            // Rank-local rows are unpacked directly from the ov_tgt field
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -698,6 +714,9 @@ void CoarseningRemapper::pack_and_send ()
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -717,6 +736,9 @@ void CoarseningRemapper::pack_and_send ()
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -737,6 +759,9 @@ void CoarseningRemapper::pack_and_send ()
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
+          if (pid==my_pid) {
+            return;
+          }
           const int lidpos = i - pid_lid_start(pid);
           const int offset = f_pid_offsets(pid);
 
@@ -757,8 +782,11 @@ void CoarseningRemapper::pack_and_send ()
   }
 
   // If MPI does not use dev pointers, we need to deep copy from dev to host
+  // Otherwise, we still need to make sure packing is done before MPI reads the buffer
   if (not MpiOnDev) {
     Kokkos::deep_copy (m_mpi_send_buffer,m_send_buffer);
+  } else {
+    Kokkos::fence();
   }
 
   if (not m_send_req.empty()) {
@@ -792,18 +820,25 @@ void CoarseningRemapper::recv_and_unpack ()
   const auto recv_lids_beg = m_recv_lids_beg;
   const auto recv_lids_end = m_recv_lids_end;
   const auto recv_lids_pidpos = m_recv_lids_pidpos;
+
+  // Contributions from this rank are read directly from the ov_tgt fields,
+  // at the ov lids that would have been packed for my_pid
+  const int my_pid = m_comm.rank();
+  const auto lids_pids = m_send_lids_pids;
+  const auto pid_lid_start = m_send_pid_lids_start;
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
           auto& f  = m_tgt_fields[ifield];
     const auto& fl = f.get_header().get_identifier().get_layout();
     const auto lt = get_layout_type(fl.tags());
     const auto f_pid_offsets = ekat::subview(m_recv_f_pid_offsets,ifield);
-
+    const auto& f_ov = m_ov_tgt_fields[ifield];
 
     f.deep_copy(0);
     switch (lt) {
       case LayoutType::Scalar2D:
       {
         auto v = f.get_view<Real*>();
+        auto ov = f_ov.get_view<const Real*>();
         Kokkos::parallel_for(RangePolicy(0,num_tgt_dofs),
                              KOKKOS_LAMBDA(const int& lid){
           const int recv_beg = recv_lids_beg(lid);
@@ -811,14 +846,19 @@ void CoarseningRemapper::recv_and_unpack ()
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
             const int lidpos = recv_lids_pidpos(irecv,1);
-            const int offset = f_pid_offsets(pid) + lidpos;
-            v(lid) += buf (offset);
+            if (pid==my_pid) {
+              v(lid) += ov(lids_pids(pid_lid_start(pid)+lidpos,0));
+            } else {
+              const int offset = f_pid_offsets(pid) + lidpos;
+              v(lid) += buf (offset);
+            }
           }
         });
       } break;
       case LayoutType::Vector2D:
       {
         auto v = f.get_view<Real**>();
+        auto ov = f_ov.get_view<const Real**>();
         const int ndims = fl.dim(1);
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,ndims);
         Kokkos::parallel_for(policy,
@@ -829,6 +869,14 @@ void CoarseningRemapper::recv_and_unpack ()
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
             const int lidpos = recv_lids_pidpos(irecv,1);
+            if (pid==my_pid) {
+              const int ov_lid = lids_pids(pid_lid_start(pid)+lidpos,0);
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),
+                                   [&](const int idim) {
+                v(lid,idim) += ov(ov_lid,idim);
+              });
+              continue;
+            }
             const int offset = f_pid_offsets(pid)+lidpos*ndims;
             Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims),
                                  [&](const int idim) {
@@ -840,6 +888,7 @@ void CoarseningRemapper::recv_and_unpack ()
       case LayoutType::Scalar3D:
       {
         auto v = f.get_view<Real**>();
+        auto ov = f_ov.get_view<const Real**>();
         const int nlevs = fl.dims().back();
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,nlevs);
         Kokkos::parallel_for(policy,
@@ -850,6 +899,14 @@ void CoarseningRemapper::recv_and_unpack ()
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
             const int lidpos = recv_lids_pidpos(irecv,1);
+            if (pid==my_pid) {
+              const int ov_lid = lids_pids(pid_lid_start(pid)+lidpos,0);
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),
+                                   [&](const int ilev) {
+                v(lid,ilev) += ov(ov_lid,ilev);
+              });
+              continue;
+            }
             const int offset = f_pid_offsets(pid) + lidpos*nlevs;
 
             Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),
@@ -862,6 +919,7 @@ void CoarseningRemapper::recv_and_unpack ()
       case LayoutType::Vector3D:
       {
         auto v = f.get_view<Real***>();
+        auto ov = f_ov.get_view<const Real***>();
         const int ndims = fl.dim(1);
         const int nlevs = fl.dims().back();
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,nlevs*ndims);
@@ -873,6 +931,16 @@ void CoarseningRemapper::recv_and_unpack ()
           for (int irecv=recv_beg; irecv<recv_end; ++irecv) {
             const int pid = recv_lids_pidpos(irecv,0);
             const int lidpos = recv_lids_pidpos(irecv,1);
+            if (pid==my_pid) {
+              const int ov_lid = lids_pids(pid_lid_start(pid)+lidpos,0);
+              Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs*ndims),
+                                   [&](const int idx) {
+                const int idim = idx / nlevs;
+                const int ilev = idx % nlevs;
+                v(lid,idim,ilev) += ov(ov_lid,idim,ilev);
+              });
+              continue;
+            }
             const int offset = f_pid_offsets(pid) + lidpos*ndims*nlevs;
 
             Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs*ndims),
@@ -1148,6 +1216,23 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
 
+  // 2b. Order the ov_tgt rows so that the ones owned by remote pids come first
+  const int my_pid = m_comm.rank();
+  m_ov_row_order = view_1d<int>("",num_ov_gids);
+  auto ov_row_order_h = Kokkos::create_mirror_view(m_ov_row_order);
+  m_num_remote_rows = 0;
+  for (int i=0; i<num_ov_gids; ++i) {
+    if (gids_owners[i]!=my_pid) {
+      ov_row_order_h(m_num_remote_rows++) = i;
+    }
+  }
+  for (int i=0,pos=m_num_remote_rows; i<num_ov_gids; ++i) {
+    if (gids_owners[i]==my_pid) {
+      ov_row_order_h(pos++) = i;
+    }
+  }
+  Kokkos::deep_copy(m_ov_row_order,ov_row_order_h);
+
   // 3. Compute offsets in send buffer for each pid/field pair
   m_send_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
   auto send_f_pid_offsets_h = Kokkos::create_mirror_view(m_send_f_pid_offsets);
@@ -1171,15 +1256,15 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   m_send_buffer = view_1d<Real>("",sum_fields_col_sizes*num_ov_gids);
   m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
 
-  // 5. Setup send requests
+  // 5. Setup send requests. Rank-local rows do not need to go through MPI.
   m_send_req.reserve(num_send_pids);
   for (const auto& it : pid2lids_send) {
     const int n = it.second.size()*sum_fields_col_sizes;
-    if (n==0) {
+    const int pid = it.first;
+    if (n==0 or pid==my_pid) {
       continue;
     }
 
-    const int pid = it.first;
     const auto send_ptr = m_mpi_send_buffer.data() + send_pid_offsets[pid];
 
     m_send_req.emplace_back();
@@ -1268,12 +1353,12 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   m_recv_buffer = view_1d<Real>("",sum_fields_col_sizes*num_total_recv_gids);
   m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
 
-  // 6. Setup recv requests
+  // 6. Setup recv requests. Rank-local contributions are read from the ov_tgt fields.
   m_recv_req.reserve(num_recv_pids);
   for (int pid=0; pid<m_comm.size(); ++pid) {
     const int num_recv_gids = recv_pid_start[pid+1] - recv_pid_start[pid];
     const int n = num_recv_gids*sum_fields_col_sizes;
-    if (n==0) {
+    if (n==0 or pid==my_pid) {
       continue;
     }
 
@@ -1300,6 +1385,8 @@ void CoarseningRemapper::clean_up ()
   m_recv_lids_pidpos    = view_2d<int>();
   m_recv_lids_beg       = view_1d<int>();
   m_recv_lids_end       = view_1d<int>();
+  m_ov_row_order        = view_1d<int>();
+  m_num_remote_rows     = 0;
   m_send_req.clear();
   m_recv_req.clear();
 
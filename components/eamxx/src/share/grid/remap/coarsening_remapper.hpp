@@ -144,7 +144,10 @@ protected:
 public:
 #endif
   template<int N>
-  void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field* mask = nullptr) const;
+  void local_mat_vec (const Field& f_src, const Field& f_tgt,
+                      const int row_beg, const int row_end,
+                      const Field* mask = nullptr) const;
+  void run_local_mat_vec (const int row_beg, const int row_end) const;
   template<int N>
   void rescale_masked_fields (const Field& f_tgt, const Field& f_mask) const;
   void pack_and_send ();
@@ -183,6 +186,12 @@ protected:
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
 
+  // The ov_tgt rows, ordered so that rows owned by remote PIDs come first.
+  // This allows to compute (and send) remote contributions first, and then
+  // compute the rank-local rows while messages are in flight.
+  view_1d<int>    m_ov_row_order;
+  int             m_num_remote_rows = 0;
+
   // ------- MPI data structures -------- //
 
   // The send/recv buf for pack/unpack
@@ -228,7 +237,9 @@ protected:
   view_1d<int>          m_recv_lids_beg;
   view_1d<int>          m_recv_lids_end;
 
-  // Send/recv requests
+  // Send/recv requests. These are persistent requests, created once and reused
+  // at every remap call. Contributions to rank-local rows do not go through MPI:
+  // they are read directly from the ov_tgt fields during unpack.
   std::vector<MPI_Request>  m_recv_req;
   std::vector<MPI_Request>  m_send_req;
 };
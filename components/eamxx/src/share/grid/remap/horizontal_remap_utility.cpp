@@ -1,8 +1,23 @@
 #include "share/grid/remap/horizontal_remap_utility.hpp"
 #include "share/util/scream_timing.hpp"
 
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
 namespace scream {
 
+namespace {
+// A chunk of fields to be remapped in the same kernel by HorizontalMap::apply_remap
+struct RemapBatch {
+  using KT = KokkosTypes<DefaultDevice>;
+  static constexpr int max_batch = 8;
+
+  KT::view_2d<const Real> src[max_batch];
+  KT::view_2d<Real>       tgt[max_batch];
+  int                     num_fields;
+  int                     max_inner;
+};
+} // anonymous namespace
+
 /*-----------------------------------------------------------------------------------------------*/
 HorizontalMap::HorizontalMap(const ekat::Comm& comm)
   : m_comm (comm)
@@ -333,9 +348,47 @@ void HorizontalMap::set_unique_source_dofs()
     // Sync to Host
     seg.sync_to_host();
   }
+  build_csr();
   stop_timer("EAMxx::HorizontalMap::set_unique_dofs");
 }
 /*-----------------------------------------------------------------------------------------------*/
+// This function builds the CSR representation of the map from the segments.  Rows are the target
+// dofs on this rank (in the order of m_dofs_gids), columns are indices in the set of unique source
+// dofs.  Target dofs with no segment have an empty row, and are remapped to zero.
+void HorizontalMap::build_csr()
+{
+  EKAT_REQUIRE_MSG(m_unique_set,"Error in HorizontalMap " + m_name + " - cannot build CSR form before setting unique source dofs.");
+  std::vector<int> row_len(m_num_dofs,0);
+  for (const auto& seg : m_map_segments) {
+    row_len[seg.get_dof_idx()] += seg.get_length();
+  }
+  m_row_offsets = view_1d<int>("",m_num_dofs+1);
+  auto row_offsets_h = Kokkos::create_mirror_view(m_row_offsets);
+  row_offsets_h(0) = 0;
+  for (int ii=0; ii<m_num_dofs; ii++) {
+    row_offsets_h(ii+1) = row_offsets_h(ii) + row_len[ii];
+  }
+  const int nnz = row_offsets_h(m_num_dofs);
+  m_csr_cols    = view_1d<int>("",nnz);
+  m_csr_weights = view_1d<Real>("",nnz);
+  auto cols_h    = Kokkos::create_mirror_view(m_csr_cols);
+  auto weights_h = Kokkos::create_mirror_view(m_csr_weights);
+  std::vector<int> pos(row_offsets_h.data(),row_offsets_h.data()+m_num_dofs);
+  for (const auto& seg : m_map_segments) {
+    const auto source_idx_h = seg.get_source_idx_on_host();
+    const auto seg_weights_h = seg.get_weights_on_host();
+    auto& p = pos[seg.get_dof_idx()];
+    for (int ii=0; ii<seg.get_length(); ii++, p++) {
+      cols_h(p)    = source_idx_h(ii);
+      weights_h(p) = seg_weights_h(ii);
+    }
+  }
+  Kokkos::deep_copy(m_row_offsets,row_offsets_h);
+  Kokkos::deep_copy(m_csr_cols,cols_h);
+  Kokkos::deep_copy(m_csr_weights,weights_h);
+  m_csr_built = true;
+}
+/*-----------------------------------------------------------------------------------------------*/
 /*-----------------------------------------------------------------------------------------------*/
 void HorizontalMap::check() const
 {
@@ -383,23 +436,12 @@ void HorizontalMap::print() const
 // a horizontal slice of remapped data.  The assumption is that there are no levels in this data.
 void HorizontalMap::apply_remap(const view_1d<const Real>& source_data, const view_1d<Real>& remapped_data) {
   start_timer("EAMxx::HorizontalMap::apply_remap_1d");
-  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      int idx = source_idx_h(ii);
-      remapped_data_h(seg_dof_idx) += source_data_h(idx)*weights_h(ii);
-    }
-  }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
+  // Strided views (e.g., subviews) cannot be reshaped via data()
+  EKAT_REQUIRE_MSG(source_data.span_is_contiguous() && remapped_data.span_is_contiguous(),
+      "Error in HorizontalMap " + m_name + " - apply_remap requires contiguous views.");
+  const view_2d<const Real> src(source_data.data(),source_data.extent(0),1);
+  const view_2d<Real>       tgt(remapped_data.data(),remapped_data.extent(0),1);
+  apply_remap(std::vector<view_2d<const Real>>{src},std::vector<view_2d<Real>>{tgt});
   stop_timer("EAMxx::HorizontalMap::apply_remap_1d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -408,26 +450,7 @@ void HorizontalMap::apply_remap(const view_1d<const Real>& source_data, const vi
 // of levels
 void HorizontalMap::apply_remap(const view_2d<const Real>& source_data, const view_2d<Real>& remapped_data) {
   start_timer("EAMxx::HorizontalMap::apply_remap_2d");
-  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  int num_levs = source_data.extent(1);
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      for (int kk=0; kk<num_levs; kk++) {
-        int idx = source_idx_h(ii);
-        remapped_data_h(seg_dof_idx,kk) += source_data_h(idx,kk)*weights_h(ii);
-      }
-    }
-  }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
+  apply_remap(std::vector<view_2d<const Real>>{source_data},std::vector<view_2d<Real>>{remapped_data});
   stop_timer("EAMxx::HorizontalMap::apply_remap_2d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -436,32 +459,105 @@ void HorizontalMap::apply_remap(const view_2d<const Real>& source_data, const vi
 // dimension for this data.
 void HorizontalMap::apply_remap(const view_3d<const Real>& source_data, const view_3d<Real>& remapped_data) {
   start_timer("EAMxx::HorizontalMap::apply_remap_3d");
-  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  int num_levs = source_data.extent(2);
-  int num_bands = source_data.extent(1);
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      for (int nn=0; nn<num_bands; nn++) {
-        for (int kk=0; kk<num_levs; kk++) {
-          int idx = source_idx_h(ii);
-          remapped_data_h(seg_dof_idx,nn,kk) += source_data_h(idx,nn,kk)*weights_h(ii);
+  if (source_data.span_is_contiguous() && remapped_data.span_is_contiguous()) {
+    // The data can be seen as (col,band*lev), and remapped by the batched version
+    const view_2d<const Real> src(source_data.data(),source_data.extent(0),source_data.extent(1)*source_data.extent(2));
+    const view_2d<Real>       tgt(remapped_data.data(),remapped_data.extent(0),remapped_data.extent(1)*remapped_data.extent(2));
+    apply_remap(std::vector<view_2d<const Real>>{src},std::vector<view_2d<Real>>{tgt});
+  } else if (m_num_dofs>0) {
+    // Strided views (e.g., subviews) cannot be reshaped via data(), so remap
+    // each (band,lev) entry, indexing the 3d views directly.
+    EKAT_REQUIRE_MSG(m_csr_built,"Error in HorizontalMap " + m_name + " - need to call set_unique_source_dofs before apply_remap.");
+    EKAT_REQUIRE_MSG(remapped_data.extent_int(0)==m_num_dofs && source_data.extent_int(0)>=m_num_unique_dofs,
+        "Error in HorizontalMap " + m_name + " - wrong number of columns in source/remapped data.");
+    EKAT_REQUIRE_MSG(source_data.extent(1)==remapped_data.extent(1) && source_data.extent(2)==remapped_data.extent(2),
+        "Error in HorizontalMap " + m_name + " - source and remapped data have different inner dimensions.");
+
+    using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+    using MemberType = typename KT::MemberType;
+    const auto row_offsets = m_row_offsets;
+    const auto cols        = m_csr_cols;
+    const auto weights     = m_csr_weights;
+    const int num_bands = source_data.extent(1);
+    const int num_levs  = source_data.extent(2);
+    const auto policy = ESU::get_default_team_policy(m_num_dofs,num_bands*num_levs);
+    Kokkos::parallel_for("HorizontalMap::apply_remap_3d",policy,KOKKOS_LAMBDA(const MemberType& team) {
+      const int row = team.league_rank();
+      const int beg = row_offsets(row);
+      const int end = row_offsets(row+1);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,num_bands*num_levs),[&](const int idx) {
+        const int nn = idx / num_levs;
+        const int kk = idx % num_levs;
+        Real y = 0;
+        for (int nz=beg; nz<end; nz++) {
+          y += weights(nz)*source_data(cols(nz),nn,kk);
         }
-      }
-    }
+        remapped_data(row,nn,kk) = y;
+      });
+    });
+    Kokkos::fence();
   }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
   stop_timer("EAMxx::HorizontalMap::apply_remap_3d");
 }
 /*-----------------------------------------------------------------------------------------------*/
+// This overload of apply remap works on a batch of fields, each seen as (col,inner). The fields
+// are processed in chunks, with one kernel per chunk: each team handles one target column, and
+// threads within the team work on the inner dimension of each field.  This way, the row of the
+// map for the target column is loaded once and reused for all the fields in the chunk.
+void HorizontalMap::apply_remap(const std::vector<view_2d<const Real>>& source_data, const std::vector<view_2d<Real>>& remapped_data) {
+  EKAT_REQUIRE_MSG(source_data.size()==remapped_data.size(),
+      "Error in HorizontalMap " + m_name + " - source and remapped data have different number of fields.");
+  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
+  EKAT_REQUIRE_MSG(m_csr_built,"Error in HorizontalMap " + m_name + " - need to call set_unique_source_dofs before apply_remap.");
+
+  const int num_fields = source_data.size();
+  for (int ifield=0; ifield<num_fields; ifield++) {
+    const auto& src = source_data[ifield];
+    const auto& tgt = remapped_data[ifield];
+    EKAT_REQUIRE_MSG(src.span_is_contiguous() && tgt.span_is_contiguous(),
+        "Error in HorizontalMap " + m_name + " - apply_remap requires contiguous views.");
+    EKAT_REQUIRE_MSG(tgt.extent_int(0)==m_num_dofs && src.extent_int(0)>=m_num_unique_dofs,
+        "Error in HorizontalMap " + m_name + " - wrong number of columns in source/remapped data.");
+    EKAT_REQUIRE_MSG(src.extent(1)==tgt.extent(1),
+        "Error in HorizontalMap " + m_name + " - source and remapped data have different inner dimension.");
+  }
+
+  constexpr int max_batch = RemapBatch::max_batch;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MemberType = typename KT::MemberType;
+  const auto row_offsets = m_row_offsets;
+  const auto cols        = m_csr_cols;
+  const auto weights     = m_csr_weights;
+  for (int ibeg=0; ibeg<num_fields; ibeg+=max_batch) {
+    RemapBatch batch;
+    batch.num_fields = std::min(max_batch,num_fields-ibeg);
+    batch.max_inner  = 0;
+    for (int ii=0; ii<batch.num_fields; ii++) {
+      batch.src[ii] = source_data[ibeg+ii];
+      batch.tgt[ii] = remapped_data[ibeg+ii];
+      batch.max_inner = std::max(batch.max_inner,source_data[ibeg+ii].extent_int(1));
+    }
+    const auto policy = ESU::get_default_team_policy(m_num_dofs,batch.max_inner);
+    Kokkos::parallel_for("HorizontalMap::apply_remap",policy,KOKKOS_LAMBDA(const MemberType& team) {
+      const int row = team.league_rank();
+      const int beg = row_offsets(row);
+      const int end = row_offsets(row+1);
+      for (int ifield=0; ifield<batch.num_fields; ifield++) {
+        const auto& src = batch.src[ifield];
+        const auto& tgt = batch.tgt[ifield];
+        Kokkos::parallel_for(Kokkos::TeamVectorRange(team,tgt.extent(1)),[&](const int kk) {
+          Real y = 0;
+          for (int nz=beg; nz<end; nz++) {
+            y += weights(nz)*src(cols(nz),kk);
+          }
+          tgt(row,kk) = y;
+        });
+      }
+    });
+  }
+  Kokkos::fence();
+}
+/*-----------------------------------------------------------------------------------------------*/
 HorizontalMapSegment::HorizontalMapSegment(const gid_type dof_gid, const int length)
   : m_dof    (dof_gid)
   , m_length (length)
@@ -7,6 +7,7 @@
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
 #include <numeric>
+#include <vector>
 
 namespace scream {
 
@@ -84,6 +85,12 @@ private:
  *   N:          Is the total number of source columns mapping to the target column (N>=1)
  *
  * This structure follows the format used by the component coupler.
+ *
+ * Once the segments and the unique source dofs are set, the map is also stored in compressed
+ * sparse row (CSR) form, with one row per target dof, which is what apply_remap uses on device.
+ * The batched version of apply_remap remaps several fields in a single kernel, so that the
+ * map is traversed only once. The 1d/2d and batched overloads require contiguous views, while
+ * the 3d overload also accepts strided views (e.g., subviews), which it remaps without reshaping.
  * --------------------------------------
  *  A.S. Donahue (LLNL): 2022-09-07
  *===============================================================================================*/
@@ -116,6 +123,10 @@ public:
   void apply_remap(const view_1d<const Real>& source_data, const view_1d<Real>& remapped_data);
   void apply_remap(const view_2d<const Real>& source_data, const view_2d<Real>& remapped_data);
   void apply_remap(const view_3d<const Real>& source_data, const view_3d<Real>& remapped_data);
+  // Remap a batch of fields at once. Each field is seen as a 2d array (col,inner), where inner
+  // is the product of all non-column dimensions (e.g., a 3d field (col,band,lev) can be passed
+  // as a 2d view with extents (col,band*lev)).
+  void apply_remap(const std::vector<view_2d<const Real>>& source_data, const std::vector<view_2d<Real>>& remapped_data);
  
   // Helper functions
   void check() const;      // A check to make sure the map is valid
@@ -126,6 +137,7 @@ public:
   void set_unique_source_dofs();
   void add_remap_segment(const HorizontalMapSegment& seg);
   void set_remap_segments_from_file(const std::string& remap_filename);
+  void build_csr();
 
   // Getter functions
   view_1d<gid_type>      get_unique_source_dofs() const { return m_unique_dofs; }
@@ -149,6 +161,13 @@ private:
   bool                   m_dofs_set = false;
   std::vector<HorizontalMapSegment> m_map_segments;
   int                    m_num_segments = 0;
+  // HorizontalMap in CSR form: the weights of target dof ii are stored in
+  // [m_row_offsets(ii),m_row_offsets(ii+1)), along with the index of the source
+  // column in the set of unique source dofs.
+  view_1d<int>           m_row_offsets;
+  view_1d<int>           m_csr_cols;
+  view_1d<Real>          m_csr_weights;
+  bool                   m_csr_built = false;
 
 }; // struct HorizontalMap
 
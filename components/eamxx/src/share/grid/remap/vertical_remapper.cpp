@@ -323,6 +323,11 @@ void VerticalRemapper::do_registration_ends ()
 void VerticalRemapper::do_remap_fwd ()
 {
   using namespace ShortFieldTagsNames;
+
+  // Interpolation coefficients computed during a previous remap are stale,
+  // unless the time stamp of the src vertical profile says otherwise
+  ++m_remap_count;
+
   // Loop over each field
   constexpr auto can_pack = SCREAM_PACK_SIZE>1;
   const auto& tgt_pres_ap = m_remap_pres.get_header().get_alloc_properties();
@@ -388,9 +393,35 @@ void VerticalRemapper::do_remap_fwd ()
   }
 }
 
+template<int N>
+const ekat::LinInterp<Real,N>& VerticalRemapper::
+get_lin_interp (const Field& src_prof, LinInterpCache<N>& cache)
+{
+  using Pack = ekat::Pack<Real,N>;
+
+  const auto& ts = src_prof.get_header().get_tracking().get_time_stamp();
+  const bool up_to_date = cache.remap_count==m_remap_count ||
+                          (ts.is_valid() && cache.ts.is_valid() && ts==cache.ts);
+  if (cache.lin_interp==nullptr || not up_to_date) {
+    const auto& layout = src_prof.get_header().get_identifier().get_layout();
+    const int ncols = layout.dim(0);
+    const int nlevs = layout.dims().back();
+    if (cache.lin_interp==nullptr) {
+      cache.lin_interp = std::make_shared<ekat::LinInterp<Real,N>>(ncols,nlevs,m_num_remap_levs);
+    }
+    vinterp::setup_vertical_interpolation<Real,N>(src_prof.get_view<const Pack**>(),
+                                                  m_remap_pres.get_view<const Pack*>(),
+                                                  nlevs,m_num_remap_levs,*cache.lin_interp);
+  }
+  cache.ts = ts;
+  cache.remap_count = m_remap_count;
+
+  return *cache.lin_interp;
+}
+
 template<int Packsize>
 void VerticalRemapper::
-apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool mask_interp) const
+apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool mask_interp)
 {
     
     using Pack = ekat::Pack<Real,Packsize>;
@@ -404,26 +435,32 @@ apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool
     Real mask_val = mask_interp ? 0.0 : m_mask_val;
 
     Field    src_lev_f;
+    lin_interp_caches* caches;
     if (src_tag == ILEV) {
       src_lev_f = m_src_int;
+      caches = &m_int_lin_interp;
     } else {
       src_lev_f = m_src_mid;
+      caches = &m_mid_lin_interp;
     }
     auto src_lev  = src_lev_f.get_view<const Pack**>();
     auto remap_pres_view = m_remap_pres.get_view<Pack*>();
+
+    // Compute (or reuse) the interpolation coefficients for this vertical profile
+    const auto& lin_interp = get_lin_interp(src_lev_f,std::get<Packsize==1 ? 0 : 1>(*caches));
     switch(rank) {
       case 2:
       {
         auto src_view = f_src.get_view<const Pack**>();
         auto tgt_view = f_tgt.get_view<      Pack**>();
-        perform_vertical_interpolation<Real,Packsize,2>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
+        perform_vertical_interpolation<Real,Packsize,2>(src_lev,remap_pres_view,src_view,tgt_view,lin_interp,src_num_levs,m_num_remap_levs,mask_val);
         break;
       }
       case 3:
       {
         auto src_view = f_src.get_view<const Pack***>();
         auto tgt_view = f_tgt.get_view<      Pack***>();
-        perform_vertical_interpolation<Real,Packsize,3>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
+        perform_vertical_interpolation<Real,Packsize,3>(src_lev,remap_pres_view,src_view,tgt_view,lin_interp,src_num_levs,m_num_remap_levs,mask_val);
         break;
       }
       default:
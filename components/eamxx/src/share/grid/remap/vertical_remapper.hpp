@@ -3,8 +3,13 @@
 
 #include "share/field/field_tag.hpp"
 #include "share/grid/remap/abstract_remapper.hpp"
+#include "share/util/scream_time_stamp.hpp"
 
 #include "ekat/ekat_pack.hpp"
+#include "ekat/util/ekat_lin_interp.hpp"
+
+#include <memory>
+#include <tuple>
 
 namespace scream
 {
@@ -106,9 +111,24 @@ protected:
 public:
 #endif
   template<int N>
-  void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt, const bool mask_interp=false) const;
+  void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt, const bool mask_interp=false);
 protected:
 
+  // Interpolation coefficients only depend on the src/tgt vertical profiles, so all the
+  // fields with the same vertical tag can share them. They are computed at most once
+  // per remap, and are reused across remaps if the src profile has a valid time stamp
+  // that did not change since they were computed.
+  template<int N>
+  struct LinInterpCache {
+    std::shared_ptr<ekat::LinInterp<Real,N>>  lin_interp;
+    util::TimeStamp                           ts;
+    int                                       remap_count = -1;
+  };
+  using lin_interp_caches = std::tuple<LinInterpCache<1>,LinInterpCache<SCREAM_PACK_SIZE>>;
+
+  template<int N>
+  const ekat::LinInterp<Real,N>& get_lin_interp (const Field& src_prof, LinInterpCache<N>& cache);
+
   using KT = KokkosTypes<DefaultDevice>;
   using gid_t = AbstractGrid::gid_type;
 
@@ -138,6 +158,11 @@ protected:
   Field                 m_src_int;  // Src vertical profile for ILEV layouts
   bool                  m_mid_set = false;
   bool                  m_int_set = false;
+
+  // Cached interpolation coefficients for LEV/ILEV layouts, for pack sizes 1 and SCREAM_PACK_SIZE
+  lin_interp_caches     m_mid_lin_interp;
+  lin_interp_caches     m_int_lin_interp;
+  int                   m_remap_count = 0;
 };
 
 } // namespace scream
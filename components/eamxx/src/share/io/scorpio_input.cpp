@@ -1,8 +1,10 @@
 #include "share/io/scorpio_input.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
+#include "ekat/std_meta/ekat_std_utils.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <numeric>
 
@@ -155,7 +157,8 @@ set_grid (const std::shared_ptr<const AbstractGrid>& grid)
 {
   // Sanity checks
   EKAT_REQUIRE_MSG (grid, "Error! Input grid pointer is invalid.\n");
-  const bool skip_grid_chk = m_params.get<bool>("Skip_Grid_Checks",false);
+  m_subset_read = m_params.get<bool>("Subset_Read",false);
+  const bool skip_grid_chk = m_subset_read || m_params.get<bool>("Skip_Grid_Checks",false);
   if (!skip_grid_chk) {
     EKAT_REQUIRE_MSG (grid->is_unique(),
         "Error! I/O only supports grids which are 'unique', meaning that the\n"
@@ -175,6 +178,26 @@ set_grid (const std::shared_ptr<const AbstractGrid>& grid)
 
   // The grid is good. Store it.
   m_io_grid = grid;
+
+  if (m_subset_read) {
+    // PIO decompositions are cached by tag, and in subset mode two grids with the
+    // same name and number of dofs may read different columns. So we add to the tag
+    // a hash of the (rank,gid) pairs, which is the same on all ranks.
+    using hash_type = std::uint64_t;
+    const auto& comm = grid->get_comm();
+    const auto dofs_h = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+    hash_type my_hash = 0;
+    for (int i=0; i<grid->get_num_local_dofs(); ++i) {
+      // A splitmix64 step, so that the xor of different pairs is unlikely to cancel out
+      hash_type h = (static_cast<hash_type>(comm.rank()) << 32) + static_cast<hash_type>(dofs_h(i));
+      h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+      my_hash ^= h ^ (h >> 31);
+    }
+    hash_type hash;
+    MPI_Allreduce(&my_hash,&hash,1,MPI_UNSIGNED_LONG_LONG,MPI_BXOR,comm.mpi_comm());
+    m_subset_tag = "subset_" + std::to_string(hash);
+  }
 }
 
 /* ---------------------------------------------------------- */
@@ -183,11 +206,27 @@ set_grid (const std::shared_ptr<const AbstractGrid>& grid)
 //       provided the routine will read input at the last time level set by
 //       running eam_update_timesnap.
 void AtmosphereInput::read_variables (const int time_index)
+{
+  read_variables(m_fields_names,time_index);
+}
+
+void AtmosphereInput::read_variable (const std::string& name, const int time_index)
+{
+  EKAT_REQUIRE_MSG (ekat::contains(m_fields_names,name),
+      "Error! Variable was not requested at initialization.\n"
+      "  - file name: " + m_filename + "\n"
+      "  - var name : " + name + "\n");
+
+  read_variables({name},time_index);
+}
+
+void AtmosphereInput::
+read_variables (const std::vector<std::string>& names, const int time_index)
 {
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
-  for (auto const& name : m_fields_names) {
+  for (auto const& name : names) {
 
     // Read the data
     auto v1d = m_host_views_1d.at(name);
@@ -407,6 +446,9 @@ get_io_decomp(const FieldLayout& layout)
   // TODO: would be to allow for other dtypes
   std::string io_decomp_tag = (std::string("Real-") + m_io_grid->name() + "-" +
                                std::to_string(m_io_grid->get_num_global_dofs()));
+  if (m_subset_read) {
+    io_decomp_tag += "-" + m_subset_tag;
+  }
   auto dims_names = get_vec_of_dims(layout);
   for (size_t i=0; i<dims_names.size(); ++i) {
     io_decomp_tag += "-" + dims_names[i];
@@ -458,7 +500,9 @@ AtmosphereInput::get_var_dof_offsets(const FieldLayout& layout)
     // Precompute this *before* the loop, since it involves expensive collectives.
     // Besides, the loop might have different length on different ranks, so
     // computing it inside might cause deadlocks.
-    auto min_gid = m_io_grid->get_global_min_dof_gid();
+    // In subset mode, gids are already the (zero-based) column indices in the file,
+    // and the global min gid is that of the columns needed, not the file's one.
+    auto min_gid = m_subset_read ? 0 : m_io_grid->get_global_min_dof_gid();
     for (int icol=0; icol<num_cols; ++icol) {
       // Get chunk of var_dof to fill
       auto start = var_dof.begin()+icol*col_size;
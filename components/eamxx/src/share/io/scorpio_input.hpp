@@ -23,10 +23,15 @@
  *  Input Parameters
  *    Filename: STRING
  *    Fields:   ARRAY OF STRINGS
+ *    Subset_Read: BOOL (optional, default false)
  *  -----
  *  The meaning of these parameters is the following:
  *   - Filename: the name of the input file to be read.
  *   - Fields: list of names of fields to load from file. Should match the name in the file and the name in the field manager.
+ *   - Subset_Read: the dofs gids of the input grid are the (zero-based) indices of the columns
+ *     to read from the file. Each rank reads only its columns, in one collective read, and
+ *     the same column can be read by several ranks. This is meant for reading source data
+ *     that is then remapped (see HorizontalMap::get_unique_source_dofs). Grid checks are skipped.
  *  Note: you can specify lists (such as the 'Fields' list above) with either of the two syntaxes
  *    Fields: [field_name1, field_name2, ... , field_name_N]
  *    Fields:
@@ -100,6 +105,9 @@ public:
   // Read fields that were required via parameter list.
   void read_variables (const int time_index = -1);
 
+  // Read only one of the fields that were required via parameter list.
+  void read_variable (const std::string& name, const int time_index = -1);
+
   // Cleans up the class
   void finalize();
 
@@ -111,6 +119,9 @@ protected:
                   const std::map<std::string,FieldLayout>&  layouts);
   void init_scorpio_structures ();
 
+  // Read the given subset of the fields that were required via parameter list
+  void read_variables (const std::vector<std::string>& names, const int time_index);
+
   void register_variables();
   void set_degrees_of_freedom();
 
@@ -132,6 +143,10 @@ protected:
 
   bool m_inited_with_fields        = false;
   bool m_inited_with_views         = false;
+
+  // In subset mode, the tag identifies the global set of columns read by each rank
+  bool          m_subset_read      = false;
+  std::string   m_subset_tag;
 }; // Class AtmosphereInput
 
 } //namespace scream
@@ -1,9 +1,11 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/util/scream_array_utils.hpp"
 #include "share/grid/remap/coarsening_remapper.hpp"
 #include "share/grid/remap/vertical_remapper.hpp"
 #include "share/util/scream_timing.hpp"
+#include "share/util/scream_bit_rounding.hpp"
 
 #include "ekat/util/ekat_units.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
@@ -39,6 +41,82 @@ void combine (const Real& new_val, Real& curr_val, const OutputAvgType avg_type)
   }
 }
 
+// This helper function runs update(idx,val) on device for all the entries val
+// of the field, where idx is the index of val in the flattened field view.
+template<typename Update>
+void for_each_entry (const Field& field, const FieldLayout& layout, const Update& update)
+{
+  using KT = KokkosTypes<DefaultDevice>;
+
+  const auto rank = layout.rank();
+  const auto extents = layout.extents();
+  KT::RangePolicy policy(0,layout.size());
+  switch (rank) {
+    case 1:
+    {
+      // For rank-1 views, we use strided layout, since it helps us
+      // handling a few more scenarios
+      auto v = field.get_strided_view<const Real*,Device>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+        update(i,v(i));
+      });
+      break;
+    }
+    case 2:
+    {
+      auto v = field.get_view<const Real**,Device>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j;
+        unflatten_idx(idx,extents,i,j);
+        update(idx,v(i,j));
+      });
+      break;
+    }
+    case 3:
+    {
+      auto v = field.get_view<const Real***,Device>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k;
+        unflatten_idx(idx,extents,i,j,k);
+        update(idx,v(i,j,k));
+      });
+      break;
+    }
+    case 4:
+    {
+      auto v = field.get_view<const Real****,Device>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l;
+        unflatten_idx(idx,extents,i,j,k,l);
+        update(idx,v(i,j,k,l));
+      });
+      break;
+    }
+    case 5:
+    {
+      auto v = field.get_view<const Real*****,Device>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l,m;
+        unflatten_idx(idx,extents,i,j,k,l,m);
+        update(idx,v(i,j,k,l,m));
+      });
+      break;
+    }
+    case 6:
+    {
+      auto v = field.get_view<const Real******,Device>();
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        int i,j,k,l,m,n;
+        unflatten_idx(idx,extents,i,j,k,l,m,n);
+        update(idx,v(i,j,k,l,m,n));
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+  }
+}
+
 // This helper function is used to make sure that the list of fields in
 // m_fields_names is a list of unique strings, otherwise throw an error.
 void sort_and_check(std::vector<std::string>& fields)
@@ -84,22 +162,32 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<DiagnosticCache>& diag_cache)
  : m_comm         (comm)
  , m_add_time_dim (true)
 {
   using vos_t = std::vector<std::string>;
 
+  if (diag_cache) {
+    m_diag_cache = diag_cache;
+    m_owns_diag_cache = false;
+  } else {
+    m_diag_cache = std::make_shared<DiagnosticCache>();
+  }
+
   if (params.isParameter("Fill Value")) {
     m_fill_value = static_cast<float>(params.get<double>("Fill Value"));
   }
 
+  m_async_write = params.get<bool>("async_write",false);
+
   // Figure out what kind of averaging is requested
   auto avg_type = params.get<std::string>("Averaging Type");
   m_avg_type = str2avg(avg_type);
   EKAT_REQUIRE_MSG (m_avg_type!=OutputAvgType::Invalid,
       "Error! Unsupported averaging type '" + avg_type + "'.\n"
-      "       Valid options: Instant, Max, Min, Average. Case insensitive.\n");
+      "       Valid options: Instant, Max, Min, Average, Variance, StdDev, Histogram, Percentile. Case insensitive.\n");
 
   // Set all internal field managers to the simulation field manager to start with.  If
   // vertical remapping, horizontal remapping or both are used then those remapper will
@@ -144,6 +232,55 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   }
   sort_and_check(m_fields_names);
 
+  // Optionally, reduce the precision of the output data and compress it
+  if (params.isParameter("significant_bits") or params.isSublist("significant_bits_per_field")) {
+    const int all_bits = params.get<int>("significant_bits",0);
+    for (const auto& name : m_fields_names) {
+      int bits = all_bits;
+      if (params.isSublist("significant_bits_per_field")) {
+        const auto& bits_pl = params.sublist("significant_bits_per_field");
+        if (bits_pl.isParameter(name)) {
+          bits = bits_pl.get<int>(name);
+        }
+      }
+      if (bits>0) {
+        EKAT_REQUIRE_MSG (bits<std::numeric_limits<Real>::digits,
+            "Error! Invalid number of significant bits for output field.\n"
+            "  - field name: " + name + "\n"
+            "  - significant bits: " + std::to_string(bits) + "\n"
+            "  - valid range: [1," + std::to_string(std::numeric_limits<Real>::digits-1) + "]\n");
+        m_significant_bits[name] = bits;
+      }
+    }
+  }
+  // Histogram-based output needs the bins
+  if (m_avg_type==OutputAvgType::Histogram or m_avg_type==OutputAvgType::Percentile) {
+    EKAT_REQUIRE_MSG (params.isParameter("histogram_bin_edges"),
+        "Error! Averaging type '" + avg_type + "' requires the parameter 'histogram_bin_edges'.\n");
+    const auto& edges = params.get<std::vector<double>>("histogram_bin_edges");
+    m_num_hist_bins = edges.size()-1;
+    EKAT_REQUIRE_MSG (m_num_hist_bins>=1,
+        "Error! Parameter 'histogram_bin_edges' must contain at least two entries.\n");
+    m_hist_bin_edges = view_1d_dev("hist_bin_edges",edges.size());
+    auto edges_h = Kokkos::create_mirror_view(m_hist_bin_edges);
+    for (size_t i=0; i<edges.size(); ++i) {
+      EKAT_REQUIRE_MSG (i==0 or edges[i]>edges[i-1],
+          "Error! Parameter 'histogram_bin_edges' must be strictly increasing.\n");
+      edges_h(i) = edges[i];
+    }
+    Kokkos::deep_copy(m_hist_bin_edges,edges_h);
+  }
+  if (m_avg_type==OutputAvgType::Percentile) {
+    m_percentile = params.get<double>("percentile");
+    EKAT_REQUIRE_MSG (m_percentile>=0 and m_percentile<=1,
+        "Error! Parameter 'percentile' must be in [0,1].\n");
+  }
+
+  m_deflate_level = params.get<int>("deflate_level",0);
+  EKAT_REQUIRE_MSG (m_deflate_level>=0 && m_deflate_level<=9,
+      "Error! Invalid deflate level for output stream (" + std::to_string(m_deflate_level) + ").\n"
+      "       Valid options: 0 (no compression) through 9.\n");
+
   // Check if remapping and if so create the appropriate remapper 
   // Note: We currently support three remappers
   //   - vertical remapping from file
@@ -266,6 +403,29 @@ void AtmosphereOutput::restart (const std::string& filename)
   // Create an input stream on the fly, and init averaging data
   ekat::ParameterList res_params("Input Parameters");
   res_params.set<std::string>("Filename",filename);
+
+  if (has_stats_state(m_avg_type)) {
+    // The output vars are recomputed from the running statistics, so read those instead
+    std::vector<std::string> stats_names;
+    std::map<std::string,FieldLayout> stats_layouts;
+    std::map<std::string,view_1d_host> stats_host_views;
+    for (const auto& name : m_fields_names) {
+      const auto& fl = get_field(name,"io").get_header().get_identifier().get_layout();
+      stats_names.push_back(name+"_stats");
+      stats_layouts.emplace(name+"_stats",append_stats_dim(fl,stats_per_entry()));
+      stats_host_views.emplace(name+"_stats",m_host_stats_views.at(name));
+    }
+    res_params.set("Field Names",stats_names);
+
+    AtmosphereInput hist_restart (res_params,m_io_grid,stats_host_views,stats_layouts);
+    hist_restart.read_variables();
+    hist_restart.finalize();
+    for (const auto& name : m_fields_names) {
+      Kokkos::deep_copy(m_dev_stats_views.at(name),m_host_stats_views.at(name));
+    }
+    return;
+  }
+
   res_params.set("Field Names",m_fields_names);
 
   AtmosphereInput hist_restart (res_params,m_io_grid,m_host_views_1d,m_layouts);
@@ -305,10 +465,18 @@ run (const std::string& filename,
 
   using namespace scream::scorpio;
 
+  // In async mode, the host views might still be in use by a pending write
+  if (is_write_step and m_async_write) {
+    AsyncIOQueue::instance().drain(filename);
+  }
+
   // Update all diagnostics, we need to do this before applying the remapper
   // to make sure that the remapped fields are the most up to date.
-  // First we reset the diag computed map so that all diags are recomputed.
-  m_diag_computed.clear();
+  // If the cache is shared, diags already computed during this step (by this
+  // or another stream) are not recomputed. Otherwise, recompute them all.
+  if (m_owns_diag_cache) {
+    m_diag_cache->invalidate();
+  }
   for (auto& it : m_diagnostics) {
     compute_diagnostic(it.first,allow_invalid_fields);
   }
@@ -343,11 +511,10 @@ run (const std::string& filename,
 
   // Take care of updating and possibly writing fields.
   for (auto const& name : m_fields_names) {
-    // Get all the info for this field.
+    // Get all the info for this field. Note: the layout of the output var
+    // may differ from the field one (e.g., for Histogram output).
           auto  field = get_field(name,"io");
-    const auto& layout = m_layouts.at(name);
-    const auto& dims = layout.dims();
-    const auto  rank = layout.rank();
+    const auto& layout = field.get_header().get_identifier().get_layout();
 
     if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
       // Safety check: make sure that the user is ok with this
@@ -364,90 +531,27 @@ run (const std::string& filename,
         m_avg_type==OutputAvgType::Instant &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+        not is_diagnostic &&
+        m_significant_bits.count(name)==0;
 
     // Manually update the 'running-tally' views with data from the field,
     // by combining new data with current avg values.
     // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
     auto view_dev = m_dev_views_1d.at(name);
     auto data = view_dev.data();
-    KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
+    KT::RangePolicy policy(0,view_dev.size());
 
     auto avg_type = m_avg_type;
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          // For rank-1 views, we use strided layout, since it helps us
-          // handling a few more scenarios
-          auto new_view_1d = field.get_strided_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            combine(new_view_1d(i), avg_view_1d(i),avg_type);
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
-      }
+    const bool has_stats = has_stats_state(avg_type);
+    if (has_stats) {
+      // Update the running statistics. The output view is computed from them on write steps.
+      update_stats(name,field,nsteps_since_last_output);
+    } else if (not is_aliasing_field_view) {
+      // If the dev_view_1d is aliasing the field device view (must be Instant output),
+      // then there's no point in copying from the field's view to dev_view
+      for_each_entry(field,layout,KOKKOS_LAMBDA(const int idx, const Real new_val) {
+        combine(new_val,data[idx],avg_type);
+      });
     }
 
     if (is_write_step) {
@@ -456,15 +560,170 @@ run (const std::string& filename,
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
           data[i] /= nsteps_since_last_output;
         });
+      } else if (has_stats) {
+        compute_stats_output(name,nsteps_since_last_output);
+      }
+      // Bit rounding is lossy, so never do it on history restart files
+      if (m_significant_bits.count(name)==1 and filename==m_lossy_filename) {
+        const int keep_bits = m_significant_bits.at(name);
+        const Real fill_value = m_fill_value;
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+          if (data[i]!=fill_value) {
+            data[i] = bit_round(data[i],keep_bits);
+          }
+        });
       }
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
-      grid_write_data_array(filename,name,view_host.data(),view_host.size());
+      if (not m_async_write) {
+        grid_write_data_array(filename,name,view_host.data(),view_host.size());
+      }
+
+      // History restart files also need the running statistics
+      if (has_stats and filename==m_hist_restart_filename) {
+        auto stats_host = m_host_stats_views.at(name);
+        Kokkos::deep_copy (stats_host,m_dev_stats_views.at(name));
+        if (not m_async_write) {
+          grid_write_data_array(filename,name+"_stats",stats_host.data(),stats_host.size());
+        }
+      }
     }
   }
 } // run
 
+void AtmosphereOutput::
+update_stats (const std::string& name, const Field& field, const int nsamples)
+{
+  const auto& layout = field.get_header().get_identifier().get_layout();
+  auto stats = m_dev_stats_views.at(name).data();
+  switch (m_avg_type) {
+    case OutputAvgType::Variance:
+    case OutputAvgType::StdDev:
+    {
+      // Welford's algorithm. For each entry, stats stores the running
+      // mean and the running sum of squared differences from the mean (M2).
+      const Real n = nsamples;
+      for_each_entry(field,layout,KOKKOS_LAMBDA(const int idx, const Real x) {
+        Real& mean = stats[2*idx];
+        Real& M2   = stats[2*idx+1];
+        const Real delta = x - mean;
+        mean += delta/n;
+        M2   += delta*(x - mean);
+      });
+      break;
+    }
+    case OutputAvgType::Histogram:
+    case OutputAvgType::Percentile:
+    {
+      // For each entry, stats stores the number of samples in each bin.
+      // Values outside the bins range are counted in the first/last bin.
+      const int nbins = m_num_hist_bins;
+      const auto edges = m_hist_bin_edges;
+      for_each_entry(field,layout,KOKKOS_LAMBDA(const int idx, const Real x) {
+        int bin = 0;
+        while (bin<nbins-1 && x>=edges(bin+1)) {
+          ++bin;
+        }
+        stats[idx*nbins+bin] += 1;
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Averaging type '" + e2str(m_avg_type) + "' does not use running statistics.\n");
+  }
+}
+
+void AtmosphereOutput::
+compute_stats_output (const std::string& name, const int nsamples)
+{
+  const auto stats = m_dev_stats_views.at(name).data();
+  const auto out   = m_dev_views_1d.at(name).data();
+  const int  size  = m_dev_stats_views.at(name).size() / stats_per_entry();
+  const Real n = nsamples;
+  switch (m_avg_type) {
+    case OutputAvgType::Variance:
+      Kokkos::parallel_for(KT::RangePolicy(0,size), KOKKOS_LAMBDA(int i) {
+        out[i] = stats[2*i+1] / n;
+      });
+      break;
+    case OutputAvgType::StdDev:
+      Kokkos::parallel_for(KT::RangePolicy(0,size), KOKKOS_LAMBDA(int i) {
+        out[i] = std::sqrt(stats[2*i+1] / n);
+      });
+      break;
+    case OutputAvgType::Histogram:
+      // Output the fraction of samples in each bin
+      Kokkos::parallel_for(KT::RangePolicy(0,size*m_num_hist_bins), KOKKOS_LAMBDA(int i) {
+        out[i] = stats[i] / n;
+      });
+      break;
+    case OutputAvgType::Percentile:
+    {
+      // Find the bin containing the requested percentile, and interpolate linearly within it
+      const int nbins = m_num_hist_bins;
+      const auto edges = m_hist_bin_edges;
+      const Real target = m_percentile*n;
+      Kokkos::parallel_for(KT::RangePolicy(0,size), KOKKOS_LAMBDA(int i) {
+        const Real* counts = stats + i*nbins;
+        Real cum = 0;
+        int bin = 0;
+        while (bin<nbins-1 && cum+counts[bin]<target) {
+          cum += counts[bin];
+          ++bin;
+        }
+        const Real frac = counts[bin]>0 ? (target-cum)/counts[bin] : 0;
+        out[i] = edges(bin) + frac*(edges(bin+1)-edges(bin));
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Averaging type '" + e2str(m_avg_type) + "' does not use running statistics.\n");
+  }
+}
+
+int AtmosphereOutput::stats_per_entry () const
+{
+  switch (m_avg_type) {
+    case OutputAvgType::Variance:
+    case OutputAvgType::StdDev:
+      return 2;
+    case OutputAvgType::Histogram:
+    case OutputAvgType::Percentile:
+      return m_num_hist_bins;
+    default:
+      return 0;
+  }
+}
+
+FieldLayout AtmosphereOutput::
+append_stats_dim (const FieldLayout& layout, const int n) const
+{
+  using namespace ShortFieldTagsNames;
+
+  auto tags = layout.tags();
+  auto dims = layout.dims();
+  tags.push_back(CMP);
+  dims.push_back(n);
+  return FieldLayout(tags,dims);
+}
+
+void AtmosphereOutput::
+write_staged_data (const std::string& filename) const
+{
+  EKAT_REQUIRE_MSG (m_async_write,
+      "Error! AtmosphereOutput::write_staged_data should only be called in async mode.\n");
+
+  for (auto const& name : m_fields_names) {
+    const auto& view_host = m_host_views_1d.at(name);
+    scorpio::grid_write_data_array(filename,name,view_host.data(),view_host.size());
+    if (has_stats_state(m_avg_type) and filename==m_hist_restart_filename) {
+      const auto& stats_host = m_host_stats_views.at(name);
+      scorpio::grid_write_data_array(filename,name+"_stats",stats_host.data(),stats_host.size());
+    }
+  }
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
   long long rdmf = 0;
@@ -504,6 +763,9 @@ res_dep_memory_footprint () const {
     if (not can_alias_field_view) {
       rdmf += m_dev_views_1d.size()*sizeof(Real);
     }
+    if (has_stats_state(m_avg_type)) {
+      rdmf += m_dev_stats_views.at(fn).size()*sizeof(Real);
+    }
   }
 
   return rdmf;
@@ -579,11 +841,21 @@ void AtmosphereOutput::register_dimensions(const std::string& name)
  */
   using namespace ShortFieldTagsNames;
 
-  // Store the field layout
+  // Store the layout of the output variable. Histogram output has one more dimension than the field
   const auto& fid = get_field(name,"io").get_header().get_identifier();
-  const auto& layout = fid.get_layout();
+  const auto& layout = m_avg_type==OutputAvgType::Histogram
+                     ? append_stats_dim(fid.get_layout(),m_num_hist_bins)
+                     : fid.get_layout();
   m_layouts.emplace(name,layout);
 
+  // History restart files also store the running statistics
+  if (has_stats_state(m_avg_type)) {
+    const auto stats_dim = "dim" + std::to_string(stats_per_entry());
+    if (m_dims.count(stats_dim)==0) {
+      m_dims[stats_dim] = std::make_pair(stats_per_entry(),false);
+    }
+  }
+
   // Now check taht all the dims of this field are already set to be registered.
   for (int i=0; i<layout.rank(); ++i) {
     // check tag against m_dims map.  If not in there, then add it.
@@ -628,15 +900,26 @@ void AtmosphereOutput::register_views()
     // would be strided).
     //
     // We also don't want to alias to a diagnostic output since it could share memory
-    // with another diagnostic.
+    // with another diagnostic, nor to a field whose output is bit-rounded in place.
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
-        not is_diagnostic;
+        not is_diagnostic &&
+        m_significant_bits.count(name)==0;
 
     const auto size = m_layouts.at(name).size();
-    if (can_alias_field_view) {
+    if (has_stats_state(m_avg_type)) {
+      const auto stats_size = field.get_header().get_identifier().get_layout().size()*stats_per_entry();
+      m_dev_stats_views.emplace(name,view_1d_dev("",stats_size));
+      m_host_stats_views.emplace(name,Kokkos::create_mirror(m_dev_stats_views[name]));
+    }
+    if (can_alias_field_view and m_async_write) {
+      // The field will change while the IO thread writes to file, so the host view
+      // must be a separate buffer (even if Host==Device).
+      m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
+      m_host_views_1d.emplace(name,view_1d_host("",size));
+    } else if (can_alias_field_view) {
       // Alias field's data, to save storage.
       m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
       m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
@@ -670,6 +953,13 @@ reset_dev_views()
       case OutputAvgType::Average:
         Kokkos::deep_copy(m_dev_views_1d[name],0);
         break;
+      case OutputAvgType::Variance:
+      case OutputAvgType::StdDev:
+      case OutputAvgType::Histogram:
+      case OutputAvgType::Percentile:
+        // The output view is recomputed from the stats at every write
+        Kokkos::deep_copy(m_dev_stats_views[name],0);
+        break;
       default:
         EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
     }
@@ -678,27 +968,30 @@ reset_dev_views()
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
 register_variables(const std::string& filename,
-                   const std::string& fp_precision)
+                   const std::string& fp_precision,
+                   const bool allow_lossy,
+                   const bool is_history_restart)
 {
   using namespace scorpio;
   using namespace ShortFieldTagsNames;
 
-  // Cycle through all fields and register.
-  for (auto const& name : m_fields_names) {
-    auto field = get_field(name,"io");
-    auto& fid  = field.get_header().get_identifier();
+  // Compression is only available for NetCDF4 files. We find out when registering the 1st var.
+  bool compress = allow_lossy and m_deflate_level>0;
+
+  // Compute the dimensions names and the decomposition tag of a variable
+  auto get_dims_and_decomp_tag = [&](const FieldLayout& layout,
+                                     std::vector<std::string>& vec_of_dims,
+                                     std::string& io_decomp_tag) {
     // Make a unique tag for each decomposition. To reuse decomps successfully,
     // we must be careful to make the tags 1-1 with the intended decomp. Here we
     // use the I/O grid name and its global #DOFs, then append the local
     // dimension data.
     //   We use real here because the data type for the decomp is the one used
     // in the simulation and not the one used in the output file.
-    std::string io_decomp_tag = (std::string("Real-") + m_io_grid->name() + "-" +
-                                 std::to_string(m_io_grid->get_num_global_dofs()));
-    std::vector<std::string> vec_of_dims;
-    const auto& layout = fid.get_layout();
-    std::string units = to_string(fid.get_units());
-    for (int i=0; i<fid.get_layout().rank(); ++i) {
+    io_decomp_tag = (std::string("Real-") + m_io_grid->name() + "-" +
+                     std::to_string(m_io_grid->get_num_global_dofs()));
+    vec_of_dims.clear();
+    for (int i=0; i<layout.rank(); ++i) {
       auto tag_name = m_io_grid->get_dim_name(layout.tag(i));
       if (layout.tag(i)==CMP) {
         tag_name += std::to_string(layout.dim(i));
@@ -721,6 +1014,22 @@ register_variables(const std::string& filename,
     } else {
       io_decomp_tag += "-notime";
     }
+  };
+
+  // Cycle through all fields and register.
+  for (auto const& name : m_fields_names) {
+    auto field = get_field(name,"io");
+    auto& fid  = field.get_header().get_identifier();
+    std::vector<std::string> vec_of_dims;
+    std::string io_decomp_tag;
+    get_dims_and_decomp_tag(m_layouts.at(name),vec_of_dims,io_decomp_tag);
+
+    std::string units = to_string(fid.get_units());
+    if (m_avg_type==OutputAvgType::Variance) {
+      units = "(" + units + ")^2";
+    } else if (m_avg_type==OutputAvgType::Histogram) {
+      units = "1";
+    }
 
     // TODO  Need to change dtype to allow for other variables.
     // Currently the field_manager only stores Real variables so it is not an issue,
@@ -729,6 +1038,27 @@ register_variables(const std::string& filename,
     register_variable(filename, name, name, units, vec_of_dims,
                       "real",fp_precision, io_decomp_tag);
 
+    // History restart files also need the running statistics (if any)
+    if (has_stats_state(m_avg_type) and is_history_restart) {
+      const auto stats_layout = append_stats_dim(fid.get_layout(),stats_per_entry());
+      get_dims_and_decomp_tag(stats_layout,vec_of_dims,io_decomp_tag);
+      register_variable(filename, name+"_stats", name+"_stats", "", vec_of_dims,
+                        "real", "real", io_decomp_tag);
+    }
+
+    if (allow_lossy) {
+      if (compress) {
+        compress = set_variable_compression(filename,name,m_deflate_level);
+        if (not compress and m_comm.am_i_root()) {
+          printf("WARNING: deflate_level>0, but output file '%s' is not NetCDF4. Variables will not be compressed.\n",
+                 filename.c_str());
+        }
+      }
+      if (m_significant_bits.count(name)==1) {
+        set_variable_metadata(filename,name,"significant_bits",std::to_string(m_significant_bits.at(name)));
+      }
+    }
+
     // Add any extra attributes for this variable, examples include:
     //   1. A list of subfields associated with a field group output
     //   2. A CF longname (TODO)
@@ -843,9 +1173,14 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
   for (auto const& name : m_fields_names) {
     auto field = get_field(name,"io");
     const auto& fid  = field.get_header().get_identifier();
-    auto var_dof = get_var_dof_offsets(fid.get_layout());
+    auto var_dof = get_var_dof_offsets(m_layouts.at(name));
     set_dof(filename,name,var_dof.size(),var_dof.data());
     m_dofs.emplace(std::make_pair(name,var_dof.size()));
+
+    if (has_stats_state(m_avg_type) and filename==m_hist_restart_filename) {
+      auto stats_dof = get_var_dof_offsets(append_stats_dim(fid.get_layout(),stats_per_entry()));
+      set_dof(filename,name+"_stats",stats_dof.size(),stats_dof.data());
+    }
   }
 
   /* TODO: 
@@ -855,17 +1190,32 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
-                  const std::string& fp_precision)
+                  const std::string& fp_precision,
+                  const bool allow_lossy,
+                  const bool is_history_restart)
 {
   using namespace scream::scorpio;
 
+  EKAT_REQUIRE_MSG (not (allow_lossy and is_history_restart),
+      "Error! History restart files must be written without lossy compression.\n"
+      "  - filename: " + filename + "\n");
+
+  // Bit rounding and compression only affect the file(s) set up with allow_lossy=true,
+  // while running statistics are only saved in history restart files
+  if (allow_lossy) {
+    m_lossy_filename = filename;
+  }
+  if (is_history_restart) {
+    m_hist_restart_filename = filename;
+  }
+
   // Register dimensions with netCDF file.
   for (auto it : m_dims) {
     register_dimension(filename,it.first,it.first,it.second.first,it.second.second);
   }
 
   // Register variables with netCDF file.  Must come after dimensions are registered.
-  register_variables(filename,fp_precision);
+  register_variables(filename,fp_precision,allow_lossy,is_history_restart);
 
   // Set the offsets of the local dofs in the global vector.
   set_degrees_of_freedom(filename);
@@ -876,8 +1226,8 @@ setup_output_file(const std::string& filename,
 void AtmosphereOutput::
 compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
 {
-  auto skip_diag = m_diag_computed[name];
-  if (skip_diag) {
+  const auto key = diag_cache_key(name);
+  if (m_diag_cache->is_computed(key)) {
     // Diagnostic already computed, just return
     return;
   }
@@ -889,7 +1239,7 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
     compute_diagnostic(dep,allow_invalid_fields);
   }
 
-  m_diag_computed[name] = true;
+  m_diag_cache->set_computed(key);
   if (allow_invalid_fields) {
     // If any input is invalid, fill the diagnostic with invalid data
     for (auto f : diag->get_fields_in()) {
@@ -940,7 +1290,12 @@ void AtmosphereOutput::set_diagnostics()
   // NOTE: do this *after* creating all diags: in case the required
   //       field of certain diagnostics is itself a diagnostic,
   //       we want to make sure the required ones are all built.
+  // NOTE: diags retrieved from the cache are already set up.
   for (const auto& dd : m_diagnostics) {
+    const auto key = diag_cache_key(dd.first);
+    if (m_diag_cache->has_diagnostic(key)) {
+      continue;
+    }
     const auto& diag = dd.second;
     for (const auto& req : diag->get_required_field_requests()) {
       const auto& req_field = get_field(req.fid.name(),"sim");
@@ -951,6 +1306,20 @@ void AtmosphereOutput::set_diagnostics()
     //       output the diagnostic without computing it, we'll get an error.
     diag->initialize(util::TimeStamp(),RunType::Initial);
   }
+
+  // Now that they are set up, make the new diags available to other streams
+  for (const auto& dd : m_diagnostics) {
+    const auto key = diag_cache_key(dd.first);
+    if (not m_diag_cache->has_diagnostic(key)) {
+      m_diag_cache->add_diagnostic(key,dd.second);
+    }
+  }
+}
+
+std::string AtmosphereOutput::
+diag_cache_key (const std::string& diag_name) const {
+  const auto& grid_name = get_field_manager("sim")->get_grid()->name();
+  return diag_name + " [grid: " + grid_name + ", fill value: " + std::to_string(m_fill_value) + "]";
 }
 
 void AtmosphereOutput::
@@ -1025,9 +1394,15 @@ create_diagnostic (const std::string& diag_field_name) {
     m_diag_depends_on_diags[diag_field_name].resize(0);
   }
 
-  // Create the diagnostic
-  auto diag = diag_factory.create(diag_name,m_comm,params);
-  diag->set_grids(m_grids_manager);
+  // Create the diagnostic, unless another stream already did
+  std::shared_ptr<atm_diag_type> diag;
+  const auto key = diag_cache_key(diag_field_name);
+  if (m_diag_cache->has_diagnostic(key)) {
+    diag = m_diag_cache->get_diagnostic(key);
+  } else {
+    diag = diag_factory.create(diag_name,m_comm,params);
+    diag->set_grids(m_grids_manager);
+  }
   m_diagnostics.emplace(diag_field_name,diag);
   // When using remappers with certain diagnostics the get_field command can be called with both the diagnostic
   // name as saved inside the diagnostic and with the name as it is given in the output control file.  If it is
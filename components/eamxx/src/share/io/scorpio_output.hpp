@@ -3,6 +3,7 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_diagnostic_cache.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -28,6 +29,14 @@
  *  filename_prefix:              STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  async_write:                  BOOL                  (default: false)
+ *  significant_bits:             INT                   (default: 0)
+ *  significant_bits_per_field:                         (optional)
+ *     FIELD_NAME_1:              INT
+ *     ...
+ *  deflate_level:                INT                   (default: 0)
+ *  histogram_bin_edges:          ARRAY OF DOUBLES      (only for Histogram and Percentile)
+ *  percentile:                   DOUBLE                (only for Percentile)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -53,6 +62,14 @@
  *      average - average of the field over some interval.
  *      min     - minimum value of the field over time interval.
  *      max     - maximum value of the field over time interval.
+ *      variance   - variance of the field over time interval (computed with Welford's algorithm).
+ *      stddev     - standard deviation of the field over time interval.
+ *      histogram  - fraction of samples of the field falling in each bin over time interval.
+ *                   The output variables have one more dimension (the bin) than the fields.
+ *      percentile - estimate of the given percentile of the field over time interval,
+ *                   obtained by linear interpolation of the histogram (so it is only as accurate
+ *                   as the bins are fine).
+ *    All of these are computed on device in a single pass over the time samples.
  *    Here, 'time interval' is described by ${Output Frequency} and ${Output frequency_units}.
  *    E.g., with 'Output Frequency'=10 and 'Output frequency_units'="Days", the time interval is 10 days.
  *  - Fields: parameters specifying fields to output
@@ -62,6 +79,21 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - async_write: if true, on write steps the output data is only staged in host buffers
+ *    that are not aliasing any model data, and the actual write is performed (by the
+ *    OutputManager) on a background IO thread, while the model keeps running.
+ *    Requires MPI_THREAD_MULTIPLE (see scream_async_io.hpp). On checkpoint steps, the
+ *    pending writes are completed before the history restart file is added to rpointer.atm.
+ *  - significant_bits: if positive, output data is rounded (on device, before the copy to host)
+ *    so that only this many bits of the mantissa are kept (see scream_bit_rounding.hpp).
+ *    The trailing zero bits make the data much more compressible. Fill values are preserved.
+ *  - significant_bits_per_field: overrides the value of significant_bits for specific fields.
+ *  - deflate_level: if positive, output variables are chunked and compressed with the NetCDF4
+ *    deflate filter, with this compression level (1 to 9). Requires a NetCDF4 PIO type.
+ *    Rounding and compression are never applied to history restart files.
+ *  - histogram_bin_edges: the N+1 edges of the N bins used for histogram/percentile output.
+ *    Values outside the range [edges[0],edges[N]] are counted in the first/last bin.
+ *  - percentile: the percentile to compute for percentile output, as a fraction in [0,1].
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -131,9 +163,14 @@ public:
   //  - is_model_restart_output: if true, this Output is for model restart files.
   //    In this case, we have to also create an "rpointer.atm" file (which
   //    contains metadata, and is expected by the component coupled)
+  // If diag_cache is provided, diagnostics are looked up in (and added to) it, so that
+  // they can be shared with other streams. The owner of the cache is then responsible
+  // for calling its begin_step method at every step. If not provided, diagnostics are
+  // private to this stream, and recomputed at every call to run.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<DiagnosticCache>& diag_cache = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -144,10 +181,19 @@ public:
   void restart (const std::string& filename);
   void init();
   void reset_dev_views();
-  void setup_output_file (const std::string& filename, const std::string& fp_precision);
+  // If allow_lossy=false, no bit rounding nor compression is done for this file (e.g., for restart files).
+  // If is_history_restart=true, the running statistics (if any) are also saved in this file.
+  void setup_output_file (const std::string& filename, const std::string& fp_precision,
+                          const bool allow_lossy = true, const bool is_history_restart = false);
   void run (const std::string& filename, const bool write, const int nsteps_since_last_output,
             const bool allow_invalid_fields = false);
 
+  // In async mode, run() only stages output data in the host views. This method
+  // writes the staged data to file, and is meant to be called from the IO thread.
+  void write_staged_data (const std::string& filename) const;
+
+  bool is_async () const { return m_async_write; }
+
   long long res_dep_memory_footprint () const;
 
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
@@ -163,15 +209,28 @@ protected:
   std::shared_ptr<const fm_type> get_field_manager (const std::string& mode) const;
 
   void register_dimensions(const std::string& name);
-  void register_variables(const std::string& filename, const std::string& fp_precision);
+  void register_variables(const std::string& filename, const std::string& fp_precision,
+                          const bool allow_lossy, const bool is_history_restart);
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
+  int stats_per_entry () const;
+  FieldLayout append_stats_dim (const FieldLayout& layout, const int n) const;
   Field get_field(const std::string& name, const std::string mode) const;
   void compute_diagnostic (const std::string& name, const bool allow_invalid_fields = false);
   void set_diagnostics();
   void create_diagnostic (const std::string& diag_name);
+  // Diags are shared only if they have the same name, input grid, and fill value
+  std::string diag_cache_key (const std::string& diag_name) const;
+
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  // Running statistics, for the avg types that need them (see has_stats_state)
+  void update_stats (const std::string& name, const Field& field, const int nsamples);
+  void compute_stats_output (const std::string& name, const int nsamples);
 
+protected:
   // --- Internal variables --- //
   ekat::Comm                          m_comm;
 
@@ -196,7 +255,8 @@ protected:
   std::map<std::string,std::pair<int,bool>>             m_dims;
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
-  std::map<std::string,bool>                            m_diag_computed;
+  std::shared_ptr<DiagnosticCache>                      m_diag_cache;
+  bool                                                  m_owns_diag_cache = true;
 
   // Use float, so that if output fp_precision=float, this is a representable value.
   // Otherwise, you would get an error from Netcdf, like
@@ -210,6 +270,26 @@ protected:
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
   bool m_add_time_dim;
+
+  // If true, host views never alias field data, and run() does not write them to file
+  bool m_async_write = false;
+
+  // Number of mantissa bits to keep for each field (fields not in the map are not rounded),
+  // the NetCDF4 deflate level (0 means no compression), and the last file where they apply.
+  std::map<std::string,int> m_significant_bits;
+  int                       m_deflate_level = 0;
+  std::string               m_lossy_filename;
+
+  // Running statistics for each field (e.g., mean and M2 for Variance, bin counts for Histogram),
+  // stored as (field_entry,stat), which are saved in history restart files.
+  std::map<std::string,view_1d_dev>     m_dev_stats_views;
+  std::map<std::string,view_1d_host>    m_host_stats_views;
+  std::string                           m_hist_restart_filename;
+
+  // Histogram bins, and percentile (for Percentile output)
+  view_1d_dev   m_hist_bin_edges;
+  int           m_num_hist_bins = 0;
+  Real          m_percentile = 0.5;
 };
 
 } //namespace scream
@@ -0,0 +1,244 @@
+#include "share/io/scream_async_io.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+
+namespace scream {
+namespace scorpio {
+
+AsyncIOQueue& AsyncIOQueue::instance ()
+{
+  static AsyncIOQueue q;
+  return q;
+}
+
+void AsyncIOQueue::finalize ()
+{
+  if (not m_worker.joinable()) {
+    return;
+  }
+
+  drain();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv_task.notify_all();
+  m_worker.join();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_worker = std::thread();
+  m_stop = false;
+}
+
+bool AsyncIOQueue::is_supported ()
+{
+  int provided;
+  MPI_Query_thread(&provided);
+  return provided==MPI_THREAD_MULTIPLE;
+}
+
+void AsyncIOQueue::set_comm (const MPI_Comm comm)
+{
+  release_comm();
+  MPI_Comm_dup(comm,&m_comm);
+}
+
+void AsyncIOQueue::release_comm ()
+{
+  if (m_comm!=MPI_COMM_NULL) {
+    MPI_Comm_free(&m_comm);
+  }
+}
+
+void AsyncIOQueue::enqueue (const std::string& filename, const task_type& task)
+{
+  EKAT_REQUIRE_MSG (not is_worker_thread(),
+      "Error! Cannot enqueue async IO tasks from within an async IO task.\n");
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (not m_worker.joinable()) {
+      m_worker = std::thread(&AsyncIOQueue::worker_loop,this);
+    }
+    m_tasks.push_back(task);
+    m_last_task[filename] = ++m_num_enqueued;
+    m_pending_files.insert(filename);
+  }
+  m_cv_task.notify_one();
+}
+
+void AsyncIOQueue::drain ()
+{
+  if (is_worker_thread()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  EKAT_REQUIRE_MSG (m_pause_depth==0,
+      "Error! Cannot drain the async IO queue while the worker is paused.\n");
+  m_cv_idle.wait(lock,[&]{ return m_num_done==m_num_enqueued; });
+  m_pending_files.clear();
+
+  if (m_error) {
+    auto err = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(err);
+  }
+}
+
+void AsyncIOQueue::drain (const std::string& filename)
+{
+  if (is_worker_thread()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto it = m_last_task.find(filename);
+  if (it!=m_last_task.end()) {
+    const auto last = it->second;
+    EKAT_REQUIRE_MSG (last<=m_stop_at,
+        "Error! Cannot drain the async IO tasks of a file past the point where the worker is paused.\n"
+        "  - filename: " + filename + "\n");
+    m_cv_idle.wait(lock,[&]{ return m_num_done>=last; });
+    drop_done_files(last);
+  }
+
+  if (m_error) {
+    auto err = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(err);
+  }
+}
+
+void AsyncIOQueue::pause (const std::string& filename)
+{
+  if (is_worker_thread()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto it = m_last_task.find(filename);
+  const long long last = it==m_last_task.end() ? 0 : it->second;
+  if (m_pause_depth>0) {
+    EKAT_REQUIRE_MSG (last<=m_stop_at,
+        "Error! Nested pause of the async IO queue requires to run past the current stop.\n"
+        "  - filename: " + filename + "\n");
+    ++m_pause_depth;
+    return;
+  }
+  ++m_pause_depth;
+
+  if (m_pending_files.empty()) {
+    // All tasks are done, on all ranks, so there's nothing to agree on
+    m_stop_at = m_num_enqueued;
+    return;
+  }
+
+  // Do not start any new task. Each rank may have started a different number
+  // of tasks, but tasks are enqueued in the same order on all ranks, so we can
+  // stop all workers after the largest number of started tasks.
+  m_stop_at = m_num_started;
+  long long target = m_num_started;
+  lock.unlock();
+  EKAT_REQUIRE_MSG (m_comm!=MPI_COMM_NULL,
+      "Error! Cannot pause the async IO queue, since no comm was set.\n");
+  MPI_Allreduce(MPI_IN_PLACE,&target,1,MPI_LONG_LONG,MPI_MAX,m_comm);
+  lock.lock();
+
+  m_stop_at = std::max(target,last);
+  m_cv_task.notify_one();
+  m_cv_idle.wait(lock,[&]{ return m_num_done==m_stop_at; });
+  drop_done_files(m_stop_at);
+
+  if (m_error) {
+    m_pause_depth = 0;
+    m_stop_at = std::numeric_limits<long long>::max();
+    m_cv_task.notify_one();
+
+    auto err = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(err);
+  }
+}
+
+void AsyncIOQueue::resume ()
+{
+  if (is_worker_thread()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EKAT_REQUIRE_MSG (m_pause_depth>0,
+        "Error! Cannot resume the async IO queue, since it was not paused.\n");
+    if (--m_pause_depth>0) {
+      return;
+    }
+    m_stop_at = std::numeric_limits<long long>::max();
+  }
+  m_cv_task.notify_one();
+}
+
+void AsyncIOQueue::drop_done_files (const long long num_done)
+{
+  // num_done is the same on all ranks, so all ranks drop the same files
+  for (auto f = m_pending_files.begin(); f!=m_pending_files.end(); ) {
+    if (m_last_task[*f]<=num_done) {
+      f = m_pending_files.erase(f);
+    } else {
+      ++f;
+    }
+  }
+}
+
+bool AsyncIOQueue::is_worker_thread () const
+{
+  return std::this_thread::get_id()==m_worker.get_id();
+}
+
+int AsyncIOQueue::num_pending () const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_num_enqueued - m_num_done;
+}
+
+void AsyncIOQueue::worker_loop ()
+{
+  while (true) {
+    task_type task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv_task.wait(lock,[&]{
+        return m_stop or (not m_tasks.empty() and m_num_started<m_stop_at);
+      });
+      if (m_tasks.empty() or m_num_started>=m_stop_at) {
+        // Only get here if m_stop=true
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      ++m_num_started;
+    }
+
+    try {
+      task();
+    } catch (...) {
+      // Store the first error, which will be rethrown on the main thread
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (not m_error) {
+        m_error = std::current_exception();
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ++m_num_done;
+    }
+    m_cv_idle.notify_all();
+  }
+}
+
+} // namespace scorpio
+} // namespace scream
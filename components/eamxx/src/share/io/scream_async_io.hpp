@@ -0,0 +1,131 @@
+#ifndef SCREAM_ASYNC_IO_HPP
+#define SCREAM_ASYNC_IO_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <mpi.h>
+
+namespace scream {
+namespace scorpio {
+
+/*
+ * A FIFO of scorpio tasks, executed by a single background thread.
+ *
+ * This is used by output streams in async mode, so that the (blocking) PIO
+ * writes of a snapshot can overlap with the following model time steps, and
+ * by the TimeSlabReader, to prefetch the next time slab of an input file.
+ *
+ * PIO calls are collective, so the order in which they are issued must be
+ * the same on all ranks. Tasks are executed in the order they are enqueued,
+ * and each task is tagged with the file it operates on. A scorpio call issued
+ * from any other thread is bracketed by pause/resume (see
+ * scream_scorpio_interface.cpp).
+ *
+ * The queue keeps track of the files that may have pending tasks. This set
+ * only changes in enqueue, drain, and pause, which all ranks call in the same
+ * order, so it is the same on all ranks. If it is empty, pause does nothing,
+ * so scorpio calls pay nothing unless async tasks are pending. Otherwise, the
+ * ranks agree on a task boundary where all workers stop, which comes after
+ * every pending task for the file being touched, and the call is issued while
+ * the workers are stopped there. Hence, the global sequence of collective
+ * operations is the same on all ranks, PIO is never entered by two threads at
+ * once, and pending tasks for other files keep running in the background as
+ * soon as the call returns. Files whose tasks are all done at that boundary
+ * are removed from the set, so that later calls are free again.
+ *
+ * Note: while some file has pending tasks, scorpio calls must be issued by all
+ * ranks of the comm passed to set_comm, since pause is collective then.
+ *
+ * Since the worker thread performs MPI communication while the main thread
+ * keeps running the model, MPI must provide MPI_THREAD_MULTIPLE.
+ */
+class AsyncIOQueue
+{
+public:
+  using task_type = std::function<void()>;
+
+  static AsyncIOQueue& instance ();
+
+  // Whether the MPI library allows async IO (i.e., it provides MPI_THREAD_MULTIPLE)
+  static bool is_supported ();
+
+  // The ranks that issue scorpio calls (i.e., the PIO subsystem comm).
+  // The comm is duplicated, and only used to agree on where to pause.
+  void set_comm (const MPI_Comm comm);
+  void release_comm ();
+
+  // Execute all pending tasks, and stop the worker thread. Must be called
+  // before MPI is finalized (the singleton may be destroyed after that).
+  // If a task is enqueued later on, a new worker thread is started.
+  void finalize ();
+
+  // Add a task operating on the given file to the queue.
+  // The worker thread is started upon first call.
+  void enqueue (const std::string& filename, const task_type& task);
+
+  // Block until all the tasks in the queue (or only the ones enqueued so far
+  // for the given file) have been executed. If any task threw an exception,
+  // it is rethrown here. No-op if called by the worker.
+  void drain ();
+  void drain (const std::string& filename);
+
+  // Stop the worker at a task boundary that is the same on all ranks, and that
+  // comes after all the tasks enqueued so far for the given file. Must be called
+  // by all ranks, and matched by a call to resume. Nested calls are allowed, as
+  // long as they do not need the worker to stop at a later task.
+  // No-op if called by the worker.
+  void pause (const std::string& filename);
+  void resume ();
+
+  bool is_worker_thread () const;
+
+  // Number of tasks currently enqueued or in execution
+  int num_pending () const;
+
+protected:
+  AsyncIOQueue () = default;
+
+  void worker_loop ();
+
+  // Remove from m_pending_files the files whose tasks are all among the
+  // first num_done ones. Must be called with m_mutex locked.
+  void drop_done_files (const long long num_done);
+
+  std::thread               m_worker;
+  mutable std::mutex        m_mutex;
+  std::condition_variable   m_cv_task;
+  std::condition_variable   m_cv_idle;
+  std::deque<task_type>     m_tasks;
+
+  // Tasks are numbered 1,2,... in the order they are enqueued, which is the
+  // same on all ranks. The worker does not start task number n>m_stop_at.
+  long long                 m_num_enqueued = 0;
+  long long                 m_num_started  = 0;
+  long long                 m_num_done     = 0;
+  long long                 m_stop_at      = std::numeric_limits<long long>::max();
+  int                       m_pause_depth  = 0;
+
+  // Number of the last task enqueued for each file
+  std::map<std::string,long long> m_last_task;
+
+  // Files that may have pending tasks. Same on all ranks (see above).
+  std::set<std::string>     m_pending_files;
+
+  MPI_Comm                  m_comm = MPI_COMM_NULL;
+  bool                      m_stop = false;
+  std::exception_ptr        m_error;
+};
+
+} // namespace scorpio
+} // namespace scream
+
+#endif // SCREAM_ASYNC_IO_HPP
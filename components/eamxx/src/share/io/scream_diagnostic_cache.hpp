@@ -0,0 +1,105 @@
+#ifndef SCREAM_DIAGNOSTIC_CACHE_HPP
+#define SCREAM_DIAGNOSTIC_CACHE_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace scream {
+
+/*
+ * A collection of diagnostics that can be shared by several output streams.
+ *
+ * Diagnostics are stored by key (see AtmosphereOutput::diag_cache_key), and
+ * remember whether they were already computed during the current step.
+ * When several streams (possibly belonging to different OutputManager's)
+ * request the same diagnostic, it is created once, and computed at most
+ * once per step, by whichever stream runs first.
+ *
+ * The step is identified by the time stamp passed to begin_step: calling it
+ * with a new time stamp marks all diagnostics as stale, while calling it
+ * again with the same time stamp (e.g., from another OutputManager) is a no-op.
+ */
+class DiagnosticCache
+{
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  bool has_diagnostic (const std::string& key) const {
+    return m_entries.find(key)!=m_entries.end();
+  }
+
+  diag_ptr_type get_diagnostic (const std::string& key) const {
+    return get_entry(key).diag;
+  }
+
+  void add_diagnostic (const std::string& key, const diag_ptr_type& diag) {
+    EKAT_REQUIRE_MSG (not has_diagnostic(key),
+        "Error! Diagnostic was already added to the cache.\n"
+        "  - key: " + key + "\n");
+    m_entries[key].diag = diag;
+  }
+
+  void begin_step (const util::TimeStamp& ts) {
+    if (not m_step_ts.is_valid() or not (ts==m_step_ts)) {
+      m_step_ts = ts;
+      invalidate();
+    }
+  }
+
+  // Mark all diagnostics as stale
+  void invalidate () {
+    for (auto& it : m_entries) {
+      it.second.computed = false;
+    }
+  }
+
+  bool is_computed (const std::string& key) const {
+    return get_entry(key).computed;
+  }
+
+  void set_computed (const std::string& key) {
+    get_entry(key).computed = true;
+    ++m_num_computations;
+  }
+
+  // How many diagnostic evaluations were performed, across all steps
+  int num_computations () const { return m_num_computations; }
+
+  int size () const { return m_entries.size(); }
+
+protected:
+
+  struct Entry {
+    diag_ptr_type diag;
+    bool          computed = false;
+  };
+
+  const Entry& get_entry (const std::string& key) const {
+    auto it = m_entries.find(key);
+    EKAT_REQUIRE_MSG (it!=m_entries.end(),
+        "Error! Diagnostic not found in the cache.\n"
+        "  - key: " + key + "\n");
+    return it->second;
+  }
+  Entry& get_entry (const std::string& key) {
+    auto it = m_entries.find(key);
+    EKAT_REQUIRE_MSG (it!=m_entries.end(),
+        "Error! Diagnostic not found in the cache.\n"
+        "  - key: " + key + "\n");
+    return it->second;
+  }
+
+  std::map<std::string,Entry>   m_entries;
+  util::TimeStamp               m_step_ts;
+  int                           m_num_computations = 0;
+};
+
+} // namespace scream
+
+#endif // SCREAM_DIAGNOSTIC_CACHE_HPP
@@ -18,9 +18,20 @@ enum class OutputAvgType {
   Max,
   Min,
   Average,
+  Variance,
+  StdDev,
+  Histogram,
+  Percentile,
   Invalid
 };
 
+// Whether the output of this avg type is computed from some running statistics
+// (other than a single tally per entry), which need to be saved in history restart files
+inline bool has_stats_state (const OutputAvgType avg) {
+  using OAT = OutputAvgType;
+  return avg==OAT::Variance || avg==OAT::StdDev || avg==OAT::Histogram || avg==OAT::Percentile;
+}
+
 constexpr float DEFAULT_FILL_VALUE = std::numeric_limits<float>::max() / 1e5;
 
 inline std::string e2str(const OutputAvgType avg) {
@@ -30,6 +41,10 @@ inline std::string e2str(const OutputAvgType avg) {
     case OAT::Max:      return "MAX";
     case OAT::Min:      return "MIN";
     case OAT::Average:  return "AVERAGE";
+    case OAT::Variance: return "VARIANCE";
+    case OAT::StdDev:   return "STDDEV";
+    case OAT::Histogram:  return "HISTOGRAM";
+    case OAT::Percentile: return "PERCENTILE";
     default:            return "INVALID";
   }
 }
@@ -37,7 +52,8 @@ inline std::string e2str(const OutputAvgType avg) {
 inline OutputAvgType str2avg (const std::string& s) {
   auto s_ci = ekat::upper_case(s);
   using OAT = OutputAvgType;
-  for (auto e : {OAT::Instant, OAT::Max, OAT::Min, OAT::Average}) {
+  for (auto e : {OAT::Instant, OAT::Max, OAT::Min, OAT::Average,
+                 OAT::Variance, OAT::StdDev, OAT::Histogram, OAT::Percentile}) {
     if (s_ci==e2str(e)) {
       return e;
     }
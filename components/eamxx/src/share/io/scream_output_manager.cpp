@@ -2,6 +2,7 @@
 
 #include "share/io/scorpio_input.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_async_io.hpp"
 #include "share/util/scream_timing.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
@@ -85,8 +86,11 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   m_output_file_specs.save_grid_data            = out_control_pl.get("save_grid_data",!m_is_model_restart_output);
 
   // For each grid, create a separate output stream.
+  if (not m_diag_cache) {
+    m_diag_cache = std::make_shared<DiagnosticCache>();
+  }
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diag_cache);
     m_output_streams.push_back(output);
   } else {
     const auto& fields_pl = m_params.sublist("Fields");
@@ -98,7 +102,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diag_cache);
       m_output_streams.push_back(output);
     }
   }
@@ -236,26 +240,24 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   const bool is_full_checkpoint_step = is_checkpoint_step && has_checkpoint_data && not is_output_step;
   const bool is_write_step           = is_output_step || is_checkpoint_step;
 
+  // If a previous write is still in flight, wait for it, since we are going
+  // to touch the files and/or the output streams host buffers.
+  if (m_async_write and is_write_step) {
+    start_timer(timer_root+"::async_wait");
+    AsyncIOQueue::instance().drain(m_output_file_specs.filename);
+    AsyncIOQueue::instance().drain(m_checkpoint_file_specs.filename);
+    stop_timer(timer_root+"::async_wait");
+  }
+
   // Create and setup output/checkpoint file(s), if necessary
   start_timer(timer_root+"::get_new_file");
-  auto setup_output_file = [&](IOControl& control, IOFileSpecs& filespecs, bool add_to_rpointer, const std::string& file_type) {
+  auto setup_output_file = [&](IOControl& control, IOFileSpecs& filespecs, const std::string& file_type) {
     // Check if we need to open a new file
     if (not filespecs.is_open) {
       // Register all dims/vars, write geometry data (e.g. lat/lon/hyam/hybm)
       setup_file(filespecs,control,timestamp);
     }
 
-    // If we are going to write an output checkpoint file, or a model restart file,
-    // we need to append to the filename ".rhist" or ".r" respectively, and add
-    // the filename to the rpointer.atm file.
-    if (add_to_rpointer) {
-      if (m_io_comm.am_i_root()) {
-        std::ofstream rpointer;
-        rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
-        rpointer << filespecs.filename << std::endl;
-      }
-    }
-
     if (m_atm_logger) {
       m_atm_logger->info("[EAMxx::output_manager] - Writing " + file_type + ":");
       m_atm_logger->info("[EAMxx::output_manager]      CASE: " + m_casename);
@@ -264,13 +266,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   };
 
   if (is_output_step) {
-    setup_output_file(m_output_control,m_output_file_specs,m_is_model_restart_output,m_is_model_restart_output ? "model restart" : "model output");
+    setup_output_file(m_output_control,m_output_file_specs,m_is_model_restart_output ? "model restart" : "model output");
 
     // Update time (must be done _before_ writing fields)
     pio_update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
   }
   if (is_checkpoint_step) {
-    setup_output_file(m_checkpoint_control,m_checkpoint_file_specs,true,"history restart");
+    setup_output_file(m_checkpoint_control,m_checkpoint_file_specs,"history restart");
 
     if (is_full_checkpoint_step) {
       // Update time (must be done _before_ writing fields)
@@ -281,11 +283,22 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
   // Run the output streams
   start_timer(timer_root+"::run_output_streams");
+  m_diag_cache->begin_step(timestamp);
   const auto& fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
   for (auto& it : m_output_streams) {
     // Note: filename only matters if is_output_step || is_full_checkpoint_step=true. In that case, it will definitely point to a valid file name.
     it->run(fields_write_filename,is_output_step || is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output);
   }
+  if (m_async_write and (is_output_step || is_full_checkpoint_step)) {
+    // The streams only staged the data on host. Write it on the IO thread.
+    auto streams = m_output_streams;
+    auto filename = fields_write_filename;
+    AsyncIOQueue::instance().enqueue(filename,[streams,filename]() {
+      for (const auto& it : streams) {
+        it->write_staged_data(filename);
+      }
+    });
+  }
   stop_timer(timer_root+"::run_output_streams");
 
   if (is_write_step) {
@@ -301,36 +314,60 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
 
     auto write_global_data = [&](IOControl& control, IOFileSpecs& filespecs) {
-      if (m_is_model_restart_output) {
-        // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"nsteps",timestamp.get_num_steps());
-      } else if (filespecs.hist_restart_file) {
-        // Update the date of last write and sample size
-        scorpio::write_timestamp (filespecs.filename,"last_write",m_output_control.timestamp_of_last_write);
-        scorpio::set_attribute (filespecs.filename,"num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
-      }
-
-      // Write all stored globals
-      for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = it.second;
-        set_any_attribute(filespecs.filename,name,any);
-      }
+      // Grab (by value) everything needed to update the file, so that the
+      // update can be deferred to the IO thread in async mode.
+      const auto filename          = filespecs.filename;
+      const auto nsteps            = timestamp.get_num_steps();
+      const auto last_write        = m_output_control.timestamp_of_last_write;
+      const auto nsamples          = m_output_control.nsamples_since_last_write;
+      const auto is_model_restart  = m_is_model_restart_output;
+      const auto hist_restart_file = filespecs.hist_restart_file;
+      const auto globals           = m_globals;
+      const auto time_bnds         = m_time_bnds;
 
       // We're adding one snapshot to the file
       ++filespecs.num_snapshots_in_file;
 
-      if (m_time_bnds.size()>0) {
-        scorpio::grid_write_data_array(filespecs.filename, "time_bnds", m_time_bnds.data(), 2);
+      // Check if we need to close the output file
+      const bool close_file = filespecs.file_is_full();
+
+      auto update_file = [=]() {
+        if (is_model_restart) {
+          // Only write nsteps on model restart
+          set_attribute(filename,"nsteps",nsteps);
+        } else if (hist_restart_file) {
+          // Update the date of last write and sample size
+          scorpio::write_timestamp (filename,"last_write",last_write);
+          scorpio::set_attribute (filename,"num_snapshots_since_last_write",nsamples);
+        }
+
+        // Write all stored globals
+        for (const auto& it : globals) {
+          const auto& name = it.first;
+          const auto& any = it.second;
+          set_any_attribute(filename,name,any);
+        }
+
+        if (time_bnds.size()>0) {
+          scorpio::grid_write_data_array(filename, "time_bnds", time_bnds.data(), 2);
+        }
+
+        if (close_file) {
+          eam_pio_closefile(filename);
+        }
+      };
+
+      if (m_async_write) {
+        AsyncIOQueue::instance().enqueue(filename,update_file);
+      } else {
+        update_file();
       }
 
       // Since we wrote to file we need to reset the nsamples_since_last_write, the timestamp ...
       control.nsamples_since_last_write = 0;
       control.timestamp_of_last_write = timestamp;
 
-      // Check if we need to close the output file
-      if (filespecs.file_is_full()) {
-        eam_pio_closefile(filespecs.filename);
+      if (close_file) {
         filespecs.num_snapshots_in_file = 0;
         filespecs.is_open = false;
       }
@@ -340,6 +377,9 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     // Important! Process output file first, and hist restart (if any) second.
     // That's b/c write_global_data will update m_output_control.timestamp_of_last_write,
     // which is later be written as global data in the hist restart file
+    // Note: grab the file names now, since write_global_data may close the files.
+    const auto output_filename     = m_output_file_specs.filename;
+    const auto checkpoint_filename = m_checkpoint_file_specs.filename;
     if (is_output_step) {
       write_global_data(m_output_control,m_output_file_specs);
     }
@@ -347,6 +387,30 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       write_global_data(m_checkpoint_control,m_checkpoint_file_specs);
     }
     stop_timer(timer_root+"::update_snapshot_tally");
+
+    // If we wrote an output checkpoint file, or a model restart file (whose names
+    // end with ".rhist" or ".r" respectively), add the filename to the rpointer.atm
+    // file. A restarted run trusts the files listed in rpointer.atm, so in async
+    // mode the pending writes must be completed first.
+    const bool add_output_to_rpointer = is_output_step and m_is_model_restart_output;
+    if (add_output_to_rpointer or is_checkpoint_step) {
+      if (m_async_write) {
+        start_timer(timer_root+"::async_wait");
+        AsyncIOQueue::instance().drain(output_filename);
+        AsyncIOQueue::instance().drain(checkpoint_filename);
+        stop_timer(timer_root+"::async_wait");
+      }
+      if (m_io_comm.am_i_root()) {
+        std::ofstream rpointer;
+        rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
+        if (add_output_to_rpointer) {
+          rpointer << output_filename << std::endl;
+        }
+        if (is_checkpoint_step) {
+          rpointer << checkpoint_filename << std::endl;
+        }
+      }
+    }
     if (m_time_bnds.size()>0) {
       m_time_bnds[0] = m_time_bnds[1];
     }
@@ -357,6 +421,12 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Wait for any write still in flight
+  if (m_async_write) {
+    scorpio::AsyncIOQueue::instance().drain(m_output_file_specs.filename);
+    scorpio::AsyncIOQueue::instance().drain(m_checkpoint_file_specs.filename);
+  }
+
   // Close any output file still open
   if (m_output_file_specs.is_open) {
     scorpio::eam_pio_closefile (m_output_file_specs.filename);
@@ -447,16 +517,24 @@ set_params (const ekat::ParameterList& params,
     m_casename = m_params.get<std::string>("filename_prefix");
     // Match precision of Fields
     m_params.set<std::string>("Floating Point Precision","real");
+    // Restart files must be complete by the time the rpointer file is updated
+    m_params.set("async_write",false);
   } else {
     auto avg_type = m_params.get<std::string>("Averaging Type");
     m_avg_type = str2avg(avg_type);
     EKAT_REQUIRE_MSG (m_avg_type!=OutputAvgType::Invalid,
         "Error! Unsupported averaging type '" + avg_type + "'.\n"
-        "       Valid options: Instant, Max, Min, Average. Case insensitive.\n");
+        "       Valid options: Instant, Max, Min, Average, Variance, StdDev, Histogram, Percentile. Case insensitive.\n");
 
     m_output_file_specs.max_snapshots_in_file = m_params.get<int>("Max Snapshots Per File",-1);
     m_casename = m_params.get<std::string>("filename_prefix");
 
+    // Optionally, perform file writes on a background thread
+    m_async_write = m_params.get<bool>("async_write",false);
+    EKAT_REQUIRE_MSG (not m_async_write or scorpio::AsyncIOQueue::is_supported(),
+        "Error! Async output requires MPI to be initialized with MPI_THREAD_MULTIPLE.\n"
+        "   Either set 'async_write: false', or change how MPI is initialized.\n");
+
     // Allow user to ask for higher precision for normal model output,
     // but default to single to save on storage
     const auto& prec = m_params.get<std::string>("Floating Point Precision", "single");
@@ -478,8 +556,11 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
   filename = compute_filename (control,filespecs,is_checkpoint_step,timestamp);
 
   // Register new netCDF file for output. First, check no other output managers
-  // are trying to write on the same file
-  EKAT_REQUIRE_MSG (not is_file_open_c2f(filename.c_str(),Write),
+  // are trying to write on the same file. Note: the IO thread may be opening/closing files.
+  AsyncIOQueue::instance().pause(filename);
+  const bool already_open = is_file_open_c2f(filename.c_str(),Write);
+  AsyncIOQueue::instance().resume();
+  EKAT_REQUIRE_MSG (not already_open,
       "Error! File '" + filename + "' is currently open for write. Cannot share with other output managers.\n");
   register_file(filename,Write);
 
@@ -516,9 +597,12 @@ setup_file (      IOFileSpecs& filespecs, const IOControl& control,
                            ? "real"
                            : m_params.get<std::string>("Floating Point Precision");
 
-  // Make all output streams register their dims/vars
+  // Make all output streams register their dims/vars.
+  // Restart files must store the data exactly, so no lossy compression. History
+  // restart files also store the running statistics (if any) of the streams.
+  const bool allow_lossy = not (is_checkpoint_step or m_is_model_restart_output);
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision);
+    it->setup_output_file(filename,fp_precision,allow_lossy,is_checkpoint_step);
   }
 
   if (filespecs.save_grid_data) {
@@ -606,6 +690,7 @@ push_to_logger()
   m_atm_logger->info("          Output Frequency: " + std::to_string(m_output_control.frequency) + " " + m_output_control.frequency_units);
   m_atm_logger->info("         Max snaps in file: " + std::to_string(m_output_file_specs.max_snapshots_in_file));  // TODO: add "not set" if the value is -1
   m_atm_logger->info("      Includes Grid Data ?: " + bool_to_string(m_output_file_specs.save_grid_data));
+  m_atm_logger->info("             Async Write ?: " + bool_to_string(m_async_write));
   // List each GRID - TODO
   // List all FIELDS - TODO
 
@@ -109,6 +109,11 @@ public:
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
       m_atm_logger = atm_logger;
   }
+  // Share diagnostics with other OutputManager's using the same cache.
+  // Must be called before setup. If not called, a private cache is used.
+  void set_diagnostic_cache (const std::shared_ptr<DiagnosticCache>& diag_cache) {
+    m_diag_cache = diag_cache;
+  }
   void add_global (const std::string& name, const ekat::any& global);
   void run (const util::TimeStamp& current_ts);
   void finalize();
@@ -171,12 +176,18 @@ protected:
   // If the user specifies freq units "none" or "never", output is disabled
   bool m_output_disabled = false;
 
+  // If true, file writes are performed on a background thread (see scream_async_io.hpp)
+  bool m_async_write = false;
+
   // The initial time stamp of the simulation and run. For initial runs, they coincide,
   // but for restarted runs, run_t0>case_t0, with the former being the time at which the
   // restart happens, and the latter being the start time of the *original* run.
   util::TimeStamp   m_case_t0;
   util::TimeStamp   m_run_t0;
 
+  // Diagnostics used by the output streams. Each diag is computed at most once per step.
+  std::shared_ptr<DiagnosticCache> m_diag_cache;
+
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 };
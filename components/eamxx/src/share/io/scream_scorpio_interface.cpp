@@ -1,4 +1,5 @@
 #include "scream_scorpio_interface.hpp"
+#include "scream_async_io.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 #include "scream_config.h"
 
@@ -7,7 +8,9 @@
 
 #include <pio.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 
 using scream::Real;
@@ -44,6 +47,21 @@ extern "C" {
 namespace scream {
 namespace scorpio {
 
+// If async IO is in use, some tasks may still be pending on the IO thread.
+// Keep the IO thread stopped for the duration of a scorpio call, at the same
+// task on all ranks, and after all pending tasks for the file being touched.
+// This way, all ranks issue scorpio calls in the same order, while pending
+// tasks for other files can still run once the call returns. If no task is
+// pending, this does nothing (see AsyncIOQueue).
+struct AsyncIOGuard {
+  AsyncIOGuard (const std::string& filename) {
+    AsyncIOQueue::instance().pause(filename);
+  }
+  ~AsyncIOGuard () {
+    AsyncIOQueue::instance().resume();
+  }
+};
+
 // Retrieve the int codes PIO uses to specify data types
 int nctype (const std::string& type) {
   if (type=="int") {
@@ -75,28 +93,34 @@ void eam_init_pio_subsystem(const int mpicom, const int atm_id) {
   // routine to pass the appropriate values depending on if we are running
   // the full model or a unit test.
   eam_init_pio_subsystem_c2f(mpicom,atm_id);
+  AsyncIOQueue::instance().set_comm(MPI_Comm_f2c(mpicom));
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_finalize() {
+  AsyncIOQueue::instance().finalize();
   eam_pio_finalize_c2f();
+  AsyncIOQueue::instance().release_comm();
 }
 /* ----------------------------------------------------------------- */
 void register_file(const std::string& filename, const FileMode mode) {
+  AsyncIOGuard guard(filename);
   register_file_c2f(filename.c_str(),mode);
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_closefile(const std::string& filename) {
-
+  AsyncIOGuard guard(filename);
   eam_pio_closefile_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 void set_decomp(const std::string& filename) {
-
+  AsyncIOGuard guard(filename);
   set_decomp_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 int get_dimlen(const std::string& filename, const std::string& dimname)
 {
+  AsyncIOGuard guard(filename);
+
   int ncid, dimid, err;
   PIO_Offset len;
 
@@ -132,8 +156,35 @@ int get_dimlen(const std::string& filename, const std::string& dimname)
   return len;
 }
 /* ----------------------------------------------------------------- */
+bool has_dim (const std::string& filename, const std::string& dimname)
+{
+  AsyncIOGuard guard(filename);
+
+  int ncid, dimid, err;
+
+  bool was_open = is_file_open_c2f(filename.c_str(),-1);
+  if (not was_open) {
+    register_file(filename,Read);
+  }
+
+  ncid = get_file_ncid_c2f (filename.c_str());
+  err = PIOc_inq_dimid(ncid,dimname.c_str(),&dimid);
+  EKAT_REQUIRE_MSG (err==PIO_NOERR or err==PIO_EBADDIM,
+      "Error! Something went wrong while retrieving dimension id.\n"
+      " - filename : " + filename + "\n"
+      " - dimname  : " + dimname + "\n"
+      " - pio error: " + std::to_string(err) + "\n");
+  if (not was_open) {
+    eam_pio_closefile(filename);
+  }
+
+  return err==PIO_NOERR;
+}
+/* ----------------------------------------------------------------- */
 bool has_variable (const std::string& filename, const std::string& varname)
 {
+  AsyncIOGuard guard(filename);
+
   int ncid, varid, err;
 
   bool was_open = is_file_open_c2f(filename.c_str(),-1);
@@ -159,24 +210,24 @@ bool has_variable (const std::string& filename, const std::string& varname)
 }
 /* ----------------------------------------------------------------- */
 void set_dof(const std::string& filename, const std::string& varname, const Int dof_len, const std::int64_t* x_dof) {
-
+  AsyncIOGuard guard(filename);
   set_dof_c2f(filename.c_str(),varname.c_str(),dof_len,x_dof);
 }
 /* ----------------------------------------------------------------- */
 void pio_update_time(const std::string& filename, const double time) {
-
+  AsyncIOGuard guard(filename);
   pio_update_time_c2f(filename.c_str(),time);
 }
 /* ----------------------------------------------------------------- */
 void register_dimension(const std::string &filename, const std::string& shortname, const std::string& longname, const int length, const bool partitioned) {
-
+  AsyncIOGuard guard(filename);
   register_dimension_c2f(filename.c_str(), shortname.c_str(), longname.c_str(), length, partitioned);
 }
 /* ----------------------------------------------------------------- */
 void get_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
                   const std::vector<std::string>& var_dimensions,
                   const std::string& dtype, const std::string& pio_decomp_tag) {
-
+  AsyncIOGuard guard(filename);
   /* Convert the vector of strings that contains the variable dimensions to a char array */
   const int numdims = var_dimensions.size();
   std::vector<const char*> var_dimensions_c(numdims);
@@ -191,7 +242,7 @@ void get_variable(const std::string &filename, const std::string& shortname, con
 void register_variable(const std::string &filename, const std::string& shortname, const std::string& longname,
                        const std::string& units, const std::vector<std::string>& var_dimensions,
                        const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag) {
-
+  AsyncIOGuard guard(filename);
   /* Convert the vector of strings that contains the variable dimensions to a char array */
   const int numdims = var_dimensions.size();
   std::vector<const char*> var_dimensions_c(numdims);
@@ -205,10 +256,79 @@ void register_variable(const std::string &filename, const std::string& shortname
 }
 /* ----------------------------------------------------------------- */
 void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val) {
+  AsyncIOGuard guard(filename);
   set_variable_metadata_c2f(filename.c_str(),varname.c_str(),meta_name.c_str(),meta_val.c_str());
 }
 /* ----------------------------------------------------------------- */
+bool set_variable_compression (const std::string& filename, const std::string& varname, const int deflate_level) {
+  AsyncIOGuard guard(filename);
+
+  EKAT_REQUIRE_MSG (deflate_level>=1 && deflate_level<=9,
+      "[set_variable_compression] Error! Invalid deflate level.\n"
+        " - filename     : " + filename + "\n"
+        " - varname      : " + varname + "\n"
+        " - deflate level: " + std::to_string(deflate_level) + "\n");
+
+  auto ncid = get_file_ncid_c2f (filename.c_str());
+  EKAT_REQUIRE_MSG (ncid>=0,
+      "[set_variable_compression] Error! Could not retrieve file ncid.\n"
+        " - filename : " + filename + "\n");
+
+  // Filters are only available in the HDF5-based formats
+  int format, err;
+  err = PIOc_inq_format(ncid,&format);
+  EKAT_REQUIRE_MSG (err==PIO_NOERR,
+      "[set_variable_compression] Error! Something went wrong while querying file format.\n"
+        " - filename : " + filename + "\n"
+        " - pio error: " + std::to_string(err) + "\n");
+  if (format!=NC_FORMAT_NETCDF4 && format!=NC_FORMAT_NETCDF4_CLASSIC) {
+    return false;
+  }
+
+  int varid, ndims, unlimdimid;
+  err = PIOc_inq_varid(ncid,varname.c_str(),&varid);
+  EKAT_REQUIRE_MSG (err==PIO_NOERR,
+      "[set_variable_compression] Error! Something went wrong while retrieving variable id.\n"
+        " - filename : " + filename + "\n"
+        " - varname  : " + varname + "\n"
+        " - pio error: " + std::to_string(err) + "\n");
+  PIOc_inq_varndims(ncid,varid,&ndims);
+  PIOc_inq_unlimdim(ncid,&unlimdimid);
+  std::vector<int> dimids(ndims);
+  PIOc_inq_vardimid(ncid,varid,dimids.data());
+
+  // One chunk per time slice. Within a slice, keep the fastest-varying dims whole,
+  // and split the slower ones, so that each chunk has (roughly) at most 2^20 entries.
+  PIO_Offset budget = 1 << 20;
+  std::vector<PIO_Offset> chunks(ndims);
+  for (int i=ndims-1; i>=0; --i) {
+    PIO_Offset len = 1;
+    if (dimids[i]!=unlimdimid) {
+      PIOc_inq_dimlen(ncid,dimids[i],&len);
+    }
+    chunks[i] = std::max<PIO_Offset>(1,std::min(len,budget));
+    budget = std::max<PIO_Offset>(1,budget/chunks[i]);
+  }
+  err = PIOc_def_var_chunking(ncid,varid,NC_CHUNKED,chunks.data());
+  EKAT_REQUIRE_MSG (err==PIO_NOERR,
+      "[set_variable_compression] Error! Something went wrong while setting variable chunking.\n"
+        " - filename : " + filename + "\n"
+        " - varname  : " + varname + "\n"
+        " - pio error: " + std::to_string(err) + "\n");
+
+  // Shuffle the bytes before deflating: it helps a lot with (bit-rounded) floating point data
+  err = PIOc_def_var_deflate(ncid,varid,1,1,deflate_level);
+  EKAT_REQUIRE_MSG (err==PIO_NOERR,
+      "[set_variable_compression] Error! Something went wrong while setting variable deflate filter.\n"
+        " - filename : " + filename + "\n"
+        " - varname  : " + varname + "\n"
+        " - pio error: " + std::to_string(err) + "\n");
+
+  return true;
+}
+/* ----------------------------------------------------------------- */
 ekat::any get_any_attribute (const std::string& filename, const std::string& att_name) {
+  AsyncIOGuard guard(filename);
   register_file(filename,Read);
   auto ncid = get_file_ncid_c2f (filename.c_str());
   EKAT_REQUIRE_MSG (ncid>=0,
@@ -267,6 +387,7 @@ ekat::any get_any_attribute (const std::string& filename, const std::string& att
   return att;
 }
 void set_any_attribute (const std::string& filename, const std::string& att_name, const ekat::any& att) {
+  AsyncIOGuard guard(filename);
   auto ncid = get_file_ncid_c2f (filename.c_str());
   int err;
 
@@ -322,35 +443,42 @@ void set_any_attribute (const std::string& filename, const std::string& att_name
 }
 /* ----------------------------------------------------------------- */
 void eam_pio_enddef(const std::string &filename) {
+  AsyncIOGuard guard(filename);
   eam_pio_enddef_c2f(filename.c_str());
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_read_data_array<int>(const std::string &filename, const std::string &varname,
                           const int time_index, int *hbuf, const int buf_size) {
+  AsyncIOGuard guard(filename);
   grid_read_data_array_c2f_int(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<float>(const std::string &filename, const std::string &varname,
                                 const int time_index, float *hbuf, const int buf_size) {
+  AsyncIOGuard guard(filename);
   grid_read_data_array_c2f_float(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 template<>
 void grid_read_data_array<double>(const std::string &filename, const std::string &varname,
                                   const int time_index, double *hbuf, const int buf_size) {
+  AsyncIOGuard guard(filename);
   grid_read_data_array_c2f_double(filename.c_str(),varname.c_str(),time_index,hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
 template<>
 void grid_write_data_array<int>(const std::string &filename, const std::string &varname, const int* hbuf, const int buf_size) {
+  AsyncIOGuard guard(filename);
   grid_write_data_array_c2f_int(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<float>(const std::string &filename, const std::string &varname, const float* hbuf, const int buf_size) {
+  AsyncIOGuard guard(filename);
   grid_write_data_array_c2f_float(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 template<>
 void grid_write_data_array<double>(const std::string &filename, const std::string &varname, const double* hbuf, const int buf_size) {
+  AsyncIOGuard guard(filename);
   grid_write_data_array_c2f_double(filename.c_str(),varname.c_str(),hbuf,buf_size);
 }
 /* ----------------------------------------------------------------- */
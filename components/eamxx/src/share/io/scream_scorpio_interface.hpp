@@ -34,6 +34,7 @@ namespace scorpio {
   void register_file(const std::string& filename, const FileMode mode);
   /* Sets the IO decompostion for all variables in a particular filename.  Required after all variables have been registered.  Called once per file. */
   int get_dimlen(const std::string& filename, const std::string& dimname);
+  bool has_dim (const std::string& filename, const std::string& dimname);
   bool has_variable (const std::string& filename, const std::string& varname);
   void set_decomp(const std::string& filename);
   /* Sets the degrees-of-freedom for a particular variable in a particular file.  Called once for each variable, for each file. */
@@ -45,6 +46,9 @@ namespace scorpio {
                          const std::string& units, const std::vector<std::string>& var_dimensions,
                          const std::string& dtype, const std::string& nc_dtype, const std::string& pio_decomp_tag);
   void set_variable_metadata (const std::string& filename, const std::string& varname, const std::string& meta_name, const std::string& meta_val);
+  /* Enable chunking and deflate compression for a registered variable. Only NetCDF4 files support it:
+   * for other file formats this is a no-op, and false is returned. */
+  bool set_variable_compression (const std::string& filename, const std::string& varname, const int deflate_level);
   /* Register a variable with a file.  Called during the file setup, for an input stream. */
   void get_variable(const std::string& filename,const std::string& shortname, const std::string& longname,
                     const std::vector<std::string>& var_dimensions,
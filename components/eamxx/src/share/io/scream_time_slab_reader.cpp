@@ -0,0 +1,218 @@
+#include "share/io/scream_time_slab_reader.hpp"
+#include "share/io/scream_async_io.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+namespace scream
+{
+
+TimeSlabReader::
+TimeSlabReader (const ekat::ParameterList& params,
+                const std::shared_ptr<const AbstractGrid>& grid,
+                const std::map<std::string,FieldLayout>& layouts,
+                const int num_slots)
+ : m_filename (params.get<std::string>("Filename"))
+ , m_layouts  (layouts)
+ , m_slots    (num_slots)
+ , m_async    (params.get<bool>("async_prefetch",false))
+{
+  EKAT_REQUIRE_MSG (not m_async or scorpio::AsyncIOQueue::is_supported(),
+      "Error! Async prefetch requires MPI to be initialized with MPI_THREAD_MULTIPLE.\n"
+      "   Either set 'async_prefetch: false', or change how MPI is initialized.\n");
+  EKAT_REQUIRE_MSG (num_slots>=2,
+      "Error! TimeSlabReader needs at least two slots, to interpolate in time.\n"
+      "  - num slots: " + std::to_string(num_slots) + "\n");
+
+  std::map<std::string,AtmosphereInput::view_1d_host> host_views;
+  for (const auto& it : m_layouts) {
+    const auto& name = it.first;
+    const int   size = it.second.size();
+    m_names.push_back(name);
+    m_host_data[name] = view_1d_host(name+"_host",size);
+    host_views[name] = m_host_data[name];
+    for (auto& slot : m_slots) {
+      slot.data[name] = view_1d_dev(name,size);
+    }
+  }
+
+  m_input.init(params,grid,host_views,m_layouts);
+
+  EKAT_REQUIRE_MSG (scorpio::has_dim(m_filename,"time"),
+      "Error! TimeSlabReader requires a 'time' dimension in the input file.\n"
+      "  - filename: " + m_filename + "\n");
+  m_num_time_slabs = scorpio::get_dimlen(m_filename,"time");
+}
+
+TimeSlabReader::~TimeSlabReader ()
+{
+  // Make sure the IO thread is not still reading into our buffers
+  if (m_async and m_pending_itime>=0) {
+    scorpio::AsyncIOQueue::instance().drain(m_filename);
+  }
+}
+
+const FieldLayout& TimeSlabReader::
+get_layout (const std::string& name) const
+{
+  EKAT_REQUIRE_MSG (m_layouts.count(name)==1,
+      "Error! Variable not handled by this TimeSlabReader.\n"
+      "  - var name: " + name + "\n");
+  return m_layouts.at(name);
+}
+
+void TimeSlabReader::load (const int itime)
+{
+  EKAT_REQUIRE_MSG (not m_finalized,
+      "Error! TimeSlabReader::load called after finalize.\n");
+  EKAT_REQUIRE_MSG (itime>=0 and itime<m_num_time_slabs,
+      "Error! Time slab index out of bounds.\n"
+      "  - time index: " + std::to_string(itime) + "\n"
+      "  - num slabs : " + std::to_string(m_num_time_slabs) + "\n");
+
+  // The host buffers are shared, so finish any pending read first
+  complete_prefetch();
+
+  auto& slot = m_slots[slot_idx(itime)];
+  if (slot.itime!=itime) {
+    slot.itime = -1;
+    for (const auto& name : m_names) {
+      m_input.read_variable(name,itime);
+      Kokkos::deep_copy(slot.data.at(name),m_host_data.at(name));
+    }
+    slot.itime = itime;
+    ++m_num_reads;
+  }
+
+  if (itime!=m_last_loaded[1]) {
+    m_last_loaded[0] = m_last_loaded[1];
+    m_last_loaded[1] = itime;
+  }
+}
+
+void TimeSlabReader::prefetch (const int itime)
+{
+  if (m_finalized or itime<0 or itime>=m_num_time_slabs) {
+    return;
+  }
+
+  if (m_pending_itime>=0) {
+    if (not m_async and m_pending_itime==itime) {
+      // Synchronous mode: read one more variable
+      read_pending_var();
+    }
+    return;
+  }
+
+  auto& slot = m_slots[slot_idx(itime)];
+  if (slot.itime==itime or
+      (slot.itime>=0 and (slot.itime==m_last_loaded[0] or slot.itime==m_last_loaded[1]))) {
+    // Already there, or it would evict a slab in use
+    return;
+  }
+
+  slot.itime = -1;
+  m_pending_itime = itime;
+  m_pending_var = 0;
+  ++m_num_reads;
+  if (m_async) {
+    // Only read into the host buffers here; the copy to device happens on
+    // the main thread, once the slab is needed
+    scorpio::AsyncIOQueue::instance().enqueue(m_filename,[this,itime]() {
+      for (const auto& name : m_names) {
+        m_input.read_variable(name,itime);
+      }
+    });
+  } else {
+    read_pending_var();
+  }
+}
+
+bool TimeSlabReader::is_loaded (const int itime) const
+{
+  return itime>=0 and m_slots[slot_idx(itime)].itime==itime;
+}
+
+const TimeSlabReader::view_1d_dev& TimeSlabReader::
+get_data (const std::string& name, const int itime) const
+{
+  EKAT_REQUIRE_MSG (is_loaded(itime),
+      "Error! Time slab is not loaded. Did you forget to call 'load'?\n"
+      "  - time index: " + std::to_string(itime) + "\n");
+  EKAT_REQUIRE_MSG (m_layouts.count(name)==1,
+      "Error! Variable not handled by this TimeSlabReader.\n"
+      "  - var name: " + name + "\n");
+  return m_slots[slot_idx(itime)].data.at(name);
+}
+
+void TimeSlabReader::
+interpolate (const std::string& name,
+             const int itime_beg, const int itime_end,
+             const Real w_beg, const view_1d_dev& out) const
+{
+  const auto beg = get_data(name,itime_beg);
+  const auto end = get_data(name,itime_end);
+  EKAT_REQUIRE_MSG (out.size()==beg.size(),
+      "Error! Output view size does not match the variable size.\n"
+      "  - var name : " + name + "\n"
+      "  - var size : " + std::to_string(beg.size()) + "\n"
+      "  - view size: " + std::to_string(out.size()) + "\n");
+
+  const Real w_end = 1 - w_beg;
+  Kokkos::parallel_for("TimeSlabReader::interpolate",
+                       KT::RangePolicy(0,out.size()),
+                       KOKKOS_LAMBDA(const int i) {
+    out(i) = w_beg*beg(i) + w_end*end(i);
+  });
+  Kokkos::fence();
+}
+
+void TimeSlabReader::finalize ()
+{
+  if (m_finalized) {
+    return;
+  }
+  if (m_async and m_pending_itime>=0) {
+    scorpio::AsyncIOQueue::instance().drain(m_filename);
+  }
+  m_pending_itime = -1;
+  m_input.finalize();
+  m_finalized = true;
+}
+
+void TimeSlabReader::read_pending_var ()
+{
+  const auto& name = m_names[m_pending_var];
+  auto& slot = m_slots[slot_idx(m_pending_itime)];
+  m_input.read_variable(name,m_pending_itime);
+  Kokkos::deep_copy(slot.data.at(name),m_host_data.at(name));
+  ++m_pending_var;
+
+  if (m_pending_var==static_cast<int>(m_names.size())) {
+    slot.itime = m_pending_itime;
+    m_pending_itime = -1;
+  }
+}
+
+void TimeSlabReader::complete_prefetch ()
+{
+  if (m_pending_itime<0) {
+    return;
+  }
+
+  if (m_async) {
+    scorpio::AsyncIOQueue::instance().drain(m_filename);
+    auto& slot = m_slots[slot_idx(m_pending_itime)];
+    for (const auto& name : m_names) {
+      Kokkos::deep_copy(slot.data.at(name),m_host_data.at(name));
+    }
+    slot.itime = m_pending_itime;
+    m_pending_itime = -1;
+  } else {
+    while (m_pending_itime>=0) {
+      read_pending_var();
+    }
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,136 @@
+#ifndef SCREAM_TIME_SLAB_READER_HPP
+#define SCREAM_TIME_SLAB_READER_HPP
+
+#include "share/io/scorpio_input.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A reader for time series of (time-dependent) input data, such as
+ * prescribed forcings or nudging data, which are read one time slab at a time.
+ *
+ * Slabs are stored on device in a small ring buffer, so that a slab that was
+ * already read (e.g., the 'end' slab of the previous interpolation interval)
+ * is never read again. Moreover, the next slab can be prefetched while the
+ * current ones are in use:
+ *  - by default, one variable is read at each call to prefetch, so that the
+ *    cost of reading a slab is spread over several time steps. These reads
+ *    still happen inside the time step that calls prefetch. If the slab is
+ *    loaded before all its variables were prefetched (i.e., fewer prefetch
+ *    calls than variables were made), load reads the remaining ones, so
+ *    the step where the slab is loaded pays for them;
+ *  - if the parameter 'async_prefetch' is true, the whole slab is read on the
+ *    background IO thread (see AsyncIOQueue), overlapping with the model time
+ *    steps. This requires MPI_THREAD_MULTIPLE. While the read is pending,
+ *    every scorpio call (in all output streams too) synchronizes with the
+ *    IO thread, so this is off by default.
+ *
+ * Usage:
+ *  - call load(n) and load(n+1) to make the slabs bracketing the current
+ *    time available on device (this reads them, unless already prefetched);
+ *  - call prefetch(n+2) at each time step;
+ *  - call interpolate to compute the data at the current time.
+ *
+ * The input parameter list is the same as for AtmosphereInput, plus the
+ * optional 'async_prefetch' (default: false). The file must
+ * have a 'time' dimension, and all the variables must depend on it: slab n
+ * is the n-th entry along 'time'.
+ *
+ * NOTE: the file is kept open until finalize is called (or the reader is
+ *       destroyed), so that slabs can be read at any time step without
+ *       re-opening it. Users (such as SPA and Nudging) keep one reader per
+ *       file, and call finalize in their finalize_impl.
+ */
+
+class TimeSlabReader
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  using view_1d_dev  = KT::view_1d<Real>;
+  using view_1d_host = AtmosphereInput::view_1d_host;
+
+  TimeSlabReader (const ekat::ParameterList& params,
+                  const std::shared_ptr<const AbstractGrid>& grid,
+                  const std::map<std::string,FieldLayout>& layouts,
+                  const int num_slots = 3);
+
+  ~TimeSlabReader ();
+
+  // The number of time slabs in the file
+  int get_num_time_slabs () const { return m_num_time_slabs; }
+
+  // The number of slabs read from file so far (including prefetched ones)
+  int get_num_reads () const { return m_num_reads; }
+
+  const FieldLayout& get_layout (const std::string& name) const;
+
+  // Make slab itime available on device, reading it from file if needed
+  void load (const int itime);
+
+  // Start reading slab itime ahead of time. This is a no-op if the slab is
+  // already loaded, or if loading it would evict one of the last two loaded slabs.
+  void prefetch (const int itime);
+
+  // Whether slab itime is available on device
+  bool is_loaded (const int itime) const;
+
+  // The (flattened) device data of a loaded slab
+  const view_1d_dev& get_data (const std::string& name, const int itime) const;
+
+  // Time interpolation: out = w_beg*data(itime_beg) + (1-w_beg)*data(itime_end)
+  void interpolate (const std::string& name,
+                    const int itime_beg, const int itime_end,
+                    const Real w_beg, const view_1d_dev& out) const;
+
+  // Waits for pending reads, and closes the file
+  void finalize ();
+
+protected:
+
+  struct Slot {
+    int                                 itime = -1;
+    std::map<std::string,view_1d_dev>   data;
+  };
+
+  int slot_idx (const int itime) const { return itime % m_slots.size(); }
+
+  // Wait for the pending read (if any), and copy its data to device
+  void complete_prefetch ();
+
+  // Synchronous mode: read the next variable of the pending slab
+  void read_pending_var ();
+
+  std::string                           m_filename;
+  AtmosphereInput                       m_input;
+  std::vector<std::string>              m_names;
+  std::map<std::string,FieldLayout>     m_layouts;
+
+  // Host buffers where data is read into from file
+  std::map<std::string,view_1d_host>    m_host_data;
+
+  std::vector<Slot>                     m_slots;
+  int                                   m_num_time_slabs;
+  int                                   m_num_reads = 0;
+
+  // The two most recently loaded slabs, which cannot be evicted by prefetch
+  int                                   m_last_loaded[2] = {-1,-1};
+
+  // Slab being prefetched, and (if not async) the next variable to read
+  int                                   m_pending_itime = -1;
+  int                                   m_pending_var   = 0;
+
+  bool                                  m_async;
+  bool                                  m_finalized = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_TIME_SLAB_READER_HPP
@@ -2,6 +2,7 @@
 
 #include "share/io/scream_output_manager.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_async_io.hpp"
 
 #include "share/grid/mesh_free_grids_manager.hpp"
 
@@ -19,6 +20,7 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_test_utils.hpp"
 
+#include <cmath>
 #include <iomanip>
 #include <memory>
 
@@ -26,6 +28,13 @@ namespace scream {
 
 constexpr int num_output_steps = 5;
 
+#ifdef SCREAM_TEST_ASYNC_WRITE
+// Use a different casename, so that this test can run alongside io_basic
+const std::string casename = "io_basic_async";
+#else
+const std::string casename = "io_basic";
+#endif
+
 void add (const Field& f, const double v) {
   auto data = f.get_internal_view_data<Real,Host>();
   auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
@@ -34,6 +43,17 @@ void add (const Field& f, const double v) {
   }
 }
 
+bool all_close (const Field& f, const double v, const double tol) {
+  auto data = f.get_internal_view_data<Real,Host>();
+  auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+  for (int i=0; i<nscalars; ++i) {
+    if (std::abs(data[i]-v)>tol) {
+      return false;
+    }
+  }
+  return true;
+}
+
 int get_dt (const std::string& freq_units) {
   int dt;
   if (freq_units=="nsteps") {
@@ -54,6 +74,21 @@ int get_dt (const std::string& freq_units) {
   return dt;
 }
 
+// Bin edges for the HISTOGRAM and PERCENTILE averaging types.
+// For PERCENTILE, use unit bins, so that the estimate is exact
+// for the integer values of the fields (see get_fm).
+std::vector<double> get_bin_edges (const std::string& avg_type) {
+  std::vector<double> edges;
+  if (avg_type=="HISTOGRAM") {
+    edges = {0, 25, 50, 75, 100, 150};
+  } else if (avg_type=="PERCENTILE") {
+    for (int i=0; i<=200; ++i) {
+      edges.push_back(i);
+    }
+  }
+  return edges;
+}
+
 util::TimeStamp get_t0 () {
   return util::TimeStamp({2023,2,17},{0,0,0});
 }
@@ -123,7 +158,8 @@ get_fm (const std::shared_ptr<const AbstractGrid>& grid,
 
 // Returns fields after initialization
 void write (const std::string& avg_type, const std::string& freq_units,
-            const int freq, const int seed, const ekat::Comm& comm)
+            const int freq, const int seed, const bool async_write,
+            const ekat::Comm& comm)
 {
   // Create grid
   auto gm = get_gm(comm);
@@ -143,9 +179,16 @@ void write (const std::string& avg_type, const std::string& freq_units,
   // Create output params
   ekat::ParameterList om_pl;
   om_pl.set("MPI Ranks in Filename",true);
-  om_pl.set("filename_prefix",std::string("io_basic"));
+  om_pl.set("filename_prefix",casename);
   om_pl.set("Field Names",fnames);
   om_pl.set("Averaging Type", avg_type);
+  om_pl.set("async_write", async_write);
+  if (avg_type=="HISTOGRAM" or avg_type=="PERCENTILE") {
+    om_pl.set("histogram_bin_edges",get_bin_edges(avg_type));
+  }
+  if (avg_type=="PERCENTILE") {
+    om_pl.set("percentile",0.5);
+  }
   auto& ctrl_pl = om_pl.sublist("output_control");
   ctrl_pl.set("frequency_units",freq_units);
   ctrl_pl.set("Frequency",freq);
@@ -177,9 +220,91 @@ void write (const std::string& avg_type, const std::string& freq_units,
   om.finalize();
 }
 
+std::string get_filename (const std::string& avg_type, const std::string& freq_units,
+                          const int freq, const ekat::Comm& comm)
+{
+  return casename
+    + "." + avg_type
+    + "." + freq_units
+    + "_x" + std::to_string(freq)
+    + ".np" + std::to_string(comm.size())
+    + "." + get_t0().to_string()
+    + ".nc";
+}
+
+// The HISTOGRAM output has an extra bin dimension, so it
+// cannot be read into the fields of the field manager
+void read_histogram (const std::string& freq_units, const int freq,
+                     const int seed, const ekat::Comm& comm)
+{
+  using namespace ShortFieldTagsNames;
+  using view_1d_host = AtmosphereInput::view_1d_host;
+
+  auto gm = get_gm (comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto fm0 = get_fm(grid,get_t0(),seed);
+
+  const auto edges = get_bin_edges("HISTOGRAM");
+  const int nbins = edges.size()-1;
+
+  std::vector<std::string> fnames;
+  std::map<std::string,FieldLayout> layouts;
+  std::map<std::string,view_1d_host> host_views;
+  for (auto it : *fm0) {
+    const auto& fn = it.second->name();
+    const auto& fl = it.second->get_header().get_identifier().get_layout();
+    auto tags = fl.tags();
+    auto dims = fl.dims();
+    tags.push_back(CMP);
+    dims.push_back(nbins);
+    FieldLayout layout(tags,dims);
+    fnames.push_back(fn);
+    layouts.emplace(fn,layout);
+    host_views[fn] = view_1d_host(fn,layout.size());
+  }
+
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",get_filename("HISTOGRAM",freq_units,freq,comm));
+  reader_pl.set("Field Names",fnames);
+  AtmosphereInput reader(reader_pl,grid,host_views,layouts);
+
+  // At output step N, the samples of an entry with initial value a
+  // are a+N*freq+1,...,a+N*freq+freq, and the output is the fraction
+  // of them falling in each bin (all the samples are within the edges)
+  for (int n=0; n<num_output_steps; ++n) {
+    reader.read_variables(n);
+    for (const auto& fn : fnames) {
+      const auto& f0 = fm0->get_field(fn);
+      auto data0 = f0.get_internal_view_data<Real,Host>();
+      const int size = f0.get_header().get_identifier().get_layout().size();
+      const auto& out = host_views.at(fn);
+      for (int i=0; i<size; ++i) {
+        std::vector<int> counts(nbins,0);
+        for (int k=1; k<=freq; ++k) {
+          const double x = data0[i] + n*freq + k;
+          for (int b=0; b<nbins; ++b) {
+            if (x>=edges[b] and x<edges[b+1]) {
+              ++counts[b];
+            }
+          }
+        }
+        for (int b=0; b<nbins; ++b) {
+          REQUIRE (out(i*nbins+b)==Approx(static_cast<double>(counts[b])/freq));
+        }
+      }
+    }
+  }
+  reader.finalize();
+}
+
 void read (const std::string& avg_type, const std::string& freq_units,
            const int freq, const int seed, const ekat::Comm& comm)
 {
+  if (avg_type=="HISTOGRAM") {
+    read_histogram(freq_units,freq,seed,comm);
+    return;
+  }
+
   // Only INSTANT writes at t=0
   bool instant = avg_type=="INSTANT";
 
@@ -202,15 +327,7 @@ void read (const std::string& avg_type, const std::string& freq_units,
 
   // Create reader pl
   ekat::ParameterList reader_pl;
-  std::string casename = "io_basic";
-  auto filename = casename
-    + "." + avg_type
-    + "." + freq_units
-    + "_x" + std::to_string(freq)
-    + ".np" + std::to_string(comm.size())
-    + "." + t0.to_string()
-    + ".nc";
-  reader_pl.set("Filename",filename);
+  reader_pl.set("Filename",get_filename(avg_type,freq_units,freq,comm));
   reader_pl.set("Field Names",fnames);
   AtmosphereInput reader(reader_pl,fm);
 
@@ -220,6 +337,9 @@ void read (const std::string& avg_type, const std::string& freq_units,
   //  avg=MAX:     output = f(N) = f(0) + N*freq
   //  avg=MIN:     output = f(N*freq+dt)
   //  avg=AVERAGE: output = f(0) + N*freq + (freq+1)/2
+  //  avg=VARIANCE: output = (freq^2-1)/12 (the variance of 1,2,...,freq)
+  //  avg=STDDEV:   output = sqrt((freq^2-1)/12)
+  //  avg=PERCENTILE (median, unit bins): output = f(0) + N*freq + 1 + freq/2
   // The last one comes from
   //   (a+1 + a+2 +..+a+freq)/freq =
   //   a + sum(i)/freq = a + (freq(freq+1)/2)/freq
@@ -238,6 +358,16 @@ void read (const std::string& avg_type, const std::string& freq_units,
       } else if (avg_type=="MAX") {
         add(f0,(n+1)*freq);
         REQUIRE (views_are_equal(f,f0));
+      } else if (avg_type=="VARIANCE") {
+        // Welford's update is not exact, so allow some roundoff
+        REQUIRE (all_close(f,(freq*freq-1)/12.0,1e-4));
+      } else if (avg_type=="STDDEV") {
+        REQUIRE (all_close(f,std::sqrt((freq*freq-1)/12.0),1e-4));
+      } else if (avg_type=="PERCENTILE") {
+        // With one sample per unit bin, the cumulative count reaches
+        // freq/2 exactly freq/2 past the lower edge of the first sample
+        add(f0,n*freq+1+freq/2.0);
+        REQUIRE (views_are_equal(f,f0));
       } else if (avg_type=="INSTANT") {
         add(f0,n*freq);
         REQUIRE (views_are_equal(f,f0));
@@ -261,12 +391,25 @@ TEST_CASE ("io_basic") {
     "INSTANT",
     "MAX",
     "MIN",
-    "AVERAGE"
+    "AVERAGE",
+    "VARIANCE",
+    "STDDEV",
+    "HISTOGRAM",
+    "PERCENTILE"
   };
 
   ekat::Comm comm(MPI_COMM_WORLD);
   scorpio::eam_init_pio_subsystem(comm);
 
+#ifdef SCREAM_TEST_ASYNC_WRITE
+  // This build of the test uses a main that inits MPI with MPI_THREAD_MULTIPLE,
+  // so that the output is written on the async IO thread.
+  REQUIRE (scorpio::AsyncIOQueue::is_supported());
+  std::vector<bool> async_write = {true};
+#else
+  std::vector<bool> async_write = {false};
+#endif
+
   auto seed = get_random_test_seed(&comm);
 
   const int freq = 5;
@@ -283,10 +426,12 @@ TEST_CASE ("io_basic") {
   for (const auto& units : freq_units) {
     print ("-> Output frequency: " + units + "\n");
     for (const auto& avg : avg_type) {
-      print("   -> Averaging type: " + avg + " ", 40);
-      write(avg,units,freq,seed,comm);
-      read(avg,units,freq,seed,comm);
-      print(" PASS\n");
+      for (const bool async : async_write) {
+        print("   -> Averaging type: " + avg + (async ? " (async) " : " "), 40);
+        write(avg,units,freq,seed,async,comm);
+        read(avg,units,freq,seed,comm);
+        print(" PASS\n");
+      }
     }
   }
   scorpio::eam_pio_finalize();
@@ -194,15 +194,30 @@ void write (const int seed, const ekat::Comm& comm)
   ctrl_pl.set("MPI Ranks in Filename",true);
   ctrl_pl.set("save_grid_data",false);
 
-  // Create Output manager
+  // Create Output managers. The second one requests the same diag, and
+  // shares the diags cache with the first one.
+  auto diag_cache = std::make_shared<DiagnosticCache>();
   OutputManager om;
+  om.set_diagnostic_cache(diag_cache);
   om.setup(comm,om_pl,fm,gm,t0,t0,false);
 
-  // Run output manager
+  auto om_pl2 = om_pl;
+  om_pl2.set("filename_prefix",std::string("io_diags_2"));
+  OutputManager om2;
+  om2.set_diagnostic_cache(diag_cache);
+  om2.setup(comm,om_pl2,fm,gm,t0,t0,false);
+
+  // Run output managers
   om.run (t0);
+  om2.run (t0);
+
+  // The diag was created and computed only once
+  REQUIRE (diag_cache->size()==1);
+  REQUIRE (diag_cache->num_computations()==1);
 
   // Close file and cleanup
   om.finalize();
+  om2.finalize();
 }
 
 void read (const int seed, const ekat::Comm& comm)
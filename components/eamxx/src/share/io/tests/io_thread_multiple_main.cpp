@@ -0,0 +1,28 @@
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+
+#include "share/scream_session.hpp"
+
+#include <mpi.h>
+
+// A catch main for IO tests that need async output. It is the same as the
+// default test main, except that MPI is initialized with MPI_THREAD_MULTIPLE,
+// which the async IO thread requires (see scream_async_io.hpp).
+int main (int argc, char** argv)
+{
+  int provided;
+  MPI_Init_thread(&argc,&argv,MPI_THREAD_MULTIPLE,&provided);
+
+  scream::initialize_scream_session(argc,argv);
+
+  Catch::Session catch_session;
+  int num_failed = catch_session.applyCommandLine(argc,argv);
+  if (num_failed==0) {
+    num_failed = catch_session.run();
+  }
+
+  scream::finalize_scream_session();
+  MPI_Finalize();
+
+  return num_failed;
+}
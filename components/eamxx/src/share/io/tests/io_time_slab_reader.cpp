@@ -0,0 +1,285 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_time_slab_reader.hpp"
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scream_async_io.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <memory>
+
+namespace scream {
+
+// Number of time slabs in the file
+constexpr int num_slabs = 6;
+
+#ifdef SCREAM_TEST_ASYNC_READ
+const std::string casename = "io_time_slab_reader_async";
+#else
+const std::string casename = "io_time_slab_reader";
+#endif
+
+// The value of entry j of variable ivar in time slab n
+Real value (const int ivar, const int n, const int j) {
+  return 1000*n + 10*j + ivar;
+}
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2023,2,17},{0,0,0});
+}
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm)
+{
+  const int nlcols = 3;
+  const int nlevs = 4;
+  const int ngcols = nlcols*comm.size();
+  ekat::ParameterList gm_params;
+  gm_params.set("number_of_global_columns",ngcols);
+  gm_params.set("number_of_vertical_levels",nlevs);
+  auto gm = create_mesh_free_grids_manager(comm,gm_params);
+  gm->build_grids();
+  return gm;
+}
+
+std::map<std::string,FieldLayout>
+get_layouts (const std::shared_ptr<const AbstractGrid>& grid)
+{
+  using namespace ShortFieldTagsNames;
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  std::map<std::string,FieldLayout> layouts;
+  layouts.emplace("f_0",FieldLayout({COL    },{nlcols      }));
+  layouts.emplace("f_1",FieldLayout({COL,LEV},{nlcols,nlevs}));
+  return layouts;
+}
+
+void set_values (const Field& f, const int ivar, const int n) {
+  auto data = f.get_internal_view_data<Real,Host>();
+  const int size = f.get_header().get_identifier().get_layout().size();
+  for (int j=0; j<size; ++j) {
+    data[j] = value(ivar,n,j);
+  }
+  f.sync_to_dev();
+}
+
+// Write num_slabs time slabs, where slab n contains value(ivar,n,j)
+void write (const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto t0 = get_t0();
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  fm->registration_begins();
+  fm->registration_ends();
+  std::vector<std::string> fnames;
+  for (const auto& it : get_layouts(grid)) {
+    FieldIdentifier fid(it.first,it.second,ekat::units::Units::nondimensional(),grid->name());
+    Field f(fid);
+    f.allocate_view();
+    set_values(f,fnames.size(),0);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    fnames.push_back(it.first);
+  }
+
+  ekat::ParameterList om_pl;
+  om_pl.set("MPI Ranks in Filename",true);
+  om_pl.set("filename_prefix",casename);
+  om_pl.set("Field Names",fnames);
+  om_pl.set("Averaging Type",std::string("INSTANT"));
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",1);
+  ctrl_pl.set("MPI Ranks in Filename",true);
+  ctrl_pl.set("save_grid_data",false);
+
+  // INSTANT output also writes the initial state, which is slab 0
+  OutputManager om;
+  om.setup(comm,om_pl,fm,gm,t0,t0,false);
+  auto t = t0;
+  for (int n=1; n<num_slabs; ++n) {
+    t += 1;
+    for (int ivar=0; ivar<static_cast<int>(fnames.size()); ++ivar) {
+      set_values(fm->get_field(fnames[ivar]),ivar,n);
+    }
+    om.run(t);
+  }
+  om.finalize();
+}
+
+TEST_CASE ("time_slab_reader") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::eam_init_pio_subsystem(comm);
+
+#ifdef SCREAM_TEST_ASYNC_READ
+  // This test runs with a main that requests MPI_THREAD_MULTIPLE
+  REQUIRE (scorpio::AsyncIOQueue::is_supported());
+  const bool async = true;
+#else
+  const bool async = false;
+#endif
+
+  write(comm);
+
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+  auto layouts = get_layouts(grid);
+  std::vector<std::string> fnames;
+  for (const auto& it : layouts) {
+    fnames.push_back(it.first);
+  }
+
+  ekat::ParameterList reader_pl;
+  reader_pl.set("Filename",casename + ".INSTANT.nsteps_x1.np" + std::to_string(comm.size())
+                           + "." + get_t0().to_string() + ".nc");
+  reader_pl.set("Field Names",fnames);
+  reader_pl.set("async_prefetch",async);
+
+  // Check the device data of a loaded slab
+  auto check_slab = [&] (const TimeSlabReader& reader, const int n) {
+    REQUIRE (reader.is_loaded(n));
+    for (int ivar=0; ivar<static_cast<int>(fnames.size()); ++ivar) {
+      auto data = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),reader.get_data(fnames[ivar],n));
+      for (int j=0; j<static_cast<int>(data.size()); ++j) {
+        REQUIRE (data(j)==value(ivar,n,j));
+      }
+    }
+  };
+
+  // Three slots: the two slabs in use, plus one prefetched
+  auto create_reader = [&] () {
+    auto reader = std::make_shared<TimeSlabReader>(reader_pl,grid,layouts,3);
+    REQUIRE (reader->get_num_time_slabs()==num_slabs);
+    REQUIRE (reader->get_num_reads()==0);
+    return reader;
+  };
+
+  // Test load
+  {
+    auto reader_ptr = create_reader();
+    auto& reader = *reader_ptr;
+    reader.load(0);
+    reader.load(1);
+    REQUIRE (reader.get_num_reads()==2);
+    check_slab(reader,0);
+    check_slab(reader,1);
+
+    // Loaded slabs are not read again
+    reader.load(0);
+    reader.load(1);
+    REQUIRE (reader.get_num_reads()==2);
+
+    REQUIRE_THROWS (reader.load(-1));
+    REQUIRE_THROWS (reader.load(num_slabs));
+    REQUIRE_THROWS (reader.get_data(fnames[0],2));
+    REQUIRE_THROWS (reader.get_data("f_missing",0));
+    reader.finalize();
+  }
+
+  // Test prefetch
+  {
+    auto reader_ptr = create_reader();
+    auto& reader = *reader_ptr;
+    reader.load(0);
+    reader.load(1);
+
+    reader.prefetch(2);
+    REQUIRE (reader.get_num_reads()==3);
+    if (not async) {
+      // Synchronous mode reads one variable per call
+      REQUIRE (not reader.is_loaded(2));
+      for (size_t i=1; i<fnames.size(); ++i) {
+        reader.prefetch(2);
+      }
+      REQUIRE (reader.is_loaded(2));
+    }
+
+    // Loading a prefetched slab does not read it again
+    reader.load(2);
+    REQUIRE (reader.get_num_reads()==3);
+    check_slab(reader,1);
+    check_slab(reader,2);
+
+    // Out of bounds prefetches are no-ops
+    reader.prefetch(-1);
+    reader.prefetch(num_slabs);
+    REQUIRE (reader.get_num_reads()==3);
+
+    // Time interpolation between two loaded slabs
+    auto out = TimeSlabReader::view_1d_dev("out",layouts.at("f_1").size());
+    reader.interpolate("f_1",1,2,0.25,out);
+    auto out_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),out);
+    for (int j=0; j<static_cast<int>(out_h.size()); ++j) {
+      REQUIRE (out_h(j)==Approx(0.25*value(1,1,j)+0.75*value(1,2,j)));
+    }
+    reader.finalize();
+  }
+
+  // Test eviction
+  {
+    auto reader_ptr = create_reader();
+    auto& reader = *reader_ptr;
+    reader.load(0);
+    reader.load(1);
+    reader.load(2);
+
+    // Slab 3 goes in the slot of slab 0, which is not in use anymore
+    reader.prefetch(3);
+    REQUIRE (reader.get_num_reads()==4);
+    REQUIRE (not reader.is_loaded(0));
+    reader.load(3);
+    REQUIRE (reader.get_num_reads()==4);
+    check_slab(reader,2);
+    check_slab(reader,3);
+
+    // Slab 5 would go in the slot of slab 2, which is in use: nothing happens
+    reader.prefetch(5);
+    REQUIRE (reader.get_num_reads()==4);
+    REQUIRE (not reader.is_loaded(5));
+    check_slab(reader,2);
+
+    // Loading always succeeds, evicting whatever is in the slot
+    reader.load(5);
+    REQUIRE (reader.get_num_reads()==5);
+    REQUIRE (not reader.is_loaded(2));
+    check_slab(reader,3);
+    check_slab(reader,5);
+    reader.finalize();
+  }
+
+  // Test finalize
+  {
+    auto reader_ptr = create_reader();
+    auto& reader = *reader_ptr;
+    // Finalize waits for a pending prefetch
+    reader.load(0);
+    reader.load(1);
+    reader.prefetch(2);
+    reader.finalize();
+    REQUIRE_THROWS (reader.load(0));
+
+    // Prefetch after finalize is a no-op, and finalize can be called twice
+    reader.prefetch(3);
+    REQUIRE (reader.get_num_reads()==3);
+    reader.finalize();
+    reader.finalize();
+  }
+
+  scorpio::eam_pio_finalize();
+}
+
+} // namespace scream
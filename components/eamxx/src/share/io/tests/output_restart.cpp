@@ -4,6 +4,7 @@
 #include "share/io/scorpio_output.hpp"
 #include "share/io/scorpio_input.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/io/scream_async_io.hpp"
 
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
@@ -42,6 +43,30 @@ void time_advance (const FieldManager& fm,
 std::shared_ptr<FieldManager>
 backup_fm (const std::shared_ptr<FieldManager>& src_fm);
 
+#if defined(SCREAM_TEST_STDDEV_RESTART)
+const std::string stats_avg_type = "StdDev";
+#elif defined(SCREAM_TEST_HISTOGRAM_RESTART)
+const std::string stats_avg_type = "Histogram";
+#else
+const std::string stats_avg_type = "";
+#endif
+
+// Averaging types with running statistics save them in the history restart
+// files, as '<field>_stats', and the restarted run must resume them exactly.
+void set_stats_params (ekat::ParameterList& params, const std::string& prefix) {
+  if (stats_avg_type=="") {
+    return;
+  }
+  const auto type = ekat::upper_case(stats_avg_type);
+  params.set("Averaging Type",stats_avg_type);
+  params.set<std::string>("filename_prefix","io_" + type + "_" + prefix);
+  if (params.isSublist("Restart")) {
+    params.sublist("Restart").set<std::string>("filename_prefix","io_" + type + "_output_restart");
+  }
+  // The fields take values in (0,21) over the 20 steps of the test
+  params.set("histogram_bin_edges",std::vector<double>{0,5,10,15,20,25});
+}
+
 TEST_CASE("output_restart","io")
 {
   // Note to AaronDonahue:  You are trying to figure out why you can't change the number of cols and levs for this test.  
@@ -71,6 +96,14 @@ TEST_CASE("output_restart","io")
   ekat::ParameterList output_params;
   ekat::parse_yaml_file(param_filename,output_params);
   output_params.set<std::string>("Floating Point Precision","real");
+#ifdef SCREAM_TEST_ASYNC_WRITE
+  // This build of the test uses a main that inits MPI with MPI_THREAD_MULTIPLE,
+  // so that output and history restart files are written on the async IO thread.
+  REQUIRE (scorpio::AsyncIOQueue::is_supported());
+  output_params.set("async_write",true);
+  output_params.set<std::string>("filename_prefix","io_async_output_restart");
+#endif
+  set_stats_params(output_params,"output_restart");
   OutputManager output_manager;
   output_manager.setup(io_comm,output_params,field_manager,gm,t0,t0,false);
 
@@ -89,6 +122,12 @@ TEST_CASE("output_restart","io")
     output_manager.run(time);
   }
 
+#ifdef SCREAM_TEST_ASYNC_WRITE
+  // Step 15 is a checkpoint step: the history restart file was added to rpointer.atm,
+  // so it must have been fully written already.
+  REQUIRE (scorpio::AsyncIOQueue::instance().num_pending()==0);
+#endif
+
   // THIS IS HACKY BUT VERY IMPORTANT!
   // E3SM relies on the 'rpointer.atm' file to write/read the name of the model/output
   // restart files. As of this point, rpointer contains the restart info for the timestep 15.
@@ -139,6 +178,12 @@ TEST_CASE("output_restart","io")
   ekat::ParameterList output_params_res;
   ekat::parse_yaml_file(param_filename_res,output_params_res);
   output_params_res.set<std::string>("Floating Point Precision","real");
+#ifdef SCREAM_TEST_ASYNC_WRITE
+  output_params_res.set("async_write",true);
+  output_params_res.set<std::string>("filename_prefix","io_async_output_restart_check");
+  output_params_res.sublist("Restart").set<std::string>("filename_prefix","io_async_output_restart");
+#endif
+  set_stats_params(output_params_res,"output_restart_check");
 
   OutputManager output_manager_res;
   output_manager_res.setup(io_comm,output_params_res,fm_res,gm,time_res,t0,false);
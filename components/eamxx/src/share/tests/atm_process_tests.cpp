@@ -4,8 +4,10 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/atm_process/ATMBufferManager.hpp"
 
 #include "share/property_checks/field_lower_bound_check.hpp"
+#include "share/field/field_manager.hpp"
 
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
@@ -338,6 +340,83 @@ protected:
   }
 };
 
+// Adds one either to all the tracers (as a group), or to tracer qa only
+class TracersAddOne : public DummyProcess
+{
+public:
+  TracersAddOne (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    m_use_group = params.get<bool>("Use Group");
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    if (m_use_group) {
+      add_group<Updated>("tracers",m_grid_name,Bundling::Required);
+    } else {
+      add_field<Updated>("qa",lt,kg/kg,m_grid_name,"tracers");
+    }
+  }
+protected:
+  void run_impl (const double /* dt */) {
+    std::vector<Field> fields;
+    if (m_use_group) {
+      for (const auto& it : get_group_out("tracers",m_grid_name).m_fields) {
+        fields.push_back(*it.second);
+      }
+    } else {
+      fields.push_back(get_field_out("qa",m_grid_name));
+    }
+    for (auto& f : fields) {
+      auto v = f.get_view<Real*,Host>();
+      for (int i=0; i<v.extent_int(0); ++i) {
+        v[i] += Real(1.0);
+      }
+    }
+  }
+
+  bool m_use_group;
+};
+
+class ScratchUser : public DummyProcess
+{
+public:
+  ScratchUser (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    m_field_name = params.get<std::string>("Field Name");
+    m_buffer_bytes = params.get<int>("Buffer Bytes");
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Updated>(m_field_name,lt,K,m_grid_name);
+  }
+
+  size_t requested_buffer_size_in_bytes () const { return m_buffer_bytes; }
+
+  void init_buffers (const ATMBufferManager& /* buffer_manager */) {}
+
+protected:
+  std::string m_field_name;
+  size_t      m_buffer_bytes;
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -492,6 +571,208 @@ TEST_CASE("atm_proc_dag", "") {
   }
 }
 
+TEST_CASE("atm_proc_schedule", "") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Create then factory, and register constructors
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("Bar",&create_atmosphere_process<Bar>);
+  factory.register_product("Baz",&create_atmosphere_process<Baz>);
+  factory.register_product("AddOne",&create_atmosphere_process<AddOne>);
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  // Bar and AddOne have no conflicts, while Baz reads what Bar computes
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Sequential");
+  params.set<std::string>("atm_procs_list","(Bar,AddOne,Baz)");
+  for (const std::string& name : {"Bar","AddOne","Baz"}) {
+    auto& p = params.sublist(name);
+    p.set<std::string>("Type", name);
+    p.set<std::string>("Grid Name", "Point Grid");
+  }
+
+  auto apg = std::make_shared<AtmosphereProcessGroup>(comm,params);
+  apg->set_grids(gm);
+
+  std::map<std::string,Field> fields;
+  for (auto r : apg->get_required_field_requests()) {
+    fields.emplace(r.fid.name(),Field(r.fid));
+  }
+  for (auto r : apg->get_computed_field_requests()) {
+    fields.emplace(r.fid.name(),Field(r.fid));
+  }
+  for (auto& it : fields) {
+    it.second.allocate_view();
+  }
+  for (auto r : apg->get_required_field_requests()) {
+    apg->set_required_field(fields.at(r.fid.name()).get_const());
+  }
+  for (auto r : apg->get_computed_field_requests()) {
+    apg->set_computed_field(fields.at(r.fid.name()));
+  }
+
+  AtmProcDAG dag;
+  dag.create_schedule(*apg);
+
+  const auto& levels = dag.schedule_levels();
+  REQUIRE (levels.size()==2);
+  REQUIRE (levels[0]==std::vector<int>{0,1});
+  REQUIRE (levels[1]==std::vector<int>{2});
+
+  const auto& deps = dag.schedule_deps();
+  REQUIRE (deps[0].empty());
+  REQUIRE (deps[1].empty());
+  REQUIRE (deps[2]==std::set<int>{0});
+
+  // Baz waits for Bar only, so the critical path is Bar+Baz
+  REQUIRE (dag.critical_path_time({1.0,2.0,3.0})==4.0);
+  REQUIRE (dag.critical_path_time({1.0,5.0,3.0})==5.0);
+}
+
+TEST_CASE("buffer_manager", "") {
+  using namespace scream;
+
+  constexpr auto R = sizeof(Real);
+  // Number of Real's in one alignment unit
+  constexpr int U = ATMBufferManager::alignment/R;
+
+  ATMBufferManager bm;
+
+  // An anonymous request, which goes at the beginning of the buffer
+  // (and is padded to the alignment)
+  bm.request_bytes(R);
+
+  // A and D are live at the same time, B and C are live at the same time.
+  // D is not a multiple of the alignment.
+  bm.request_bytes("A",10*U*R,0,0);
+  bm.request_bytes("B", 5*U*R,1,1);
+  bm.request_bytes("C", 3*U*R,1,2);
+  bm.request_bytes("D",(2*U-1)*R,0,0);
+  REQUIRE_THROWS (bm.request_bytes("A",10*R,3,3));
+  REQUIRE_THROWS (bm.request_bytes("E",10*R,3,2));
+
+  bm.allocate();
+  REQUIRE_THROWS (bm.request_bytes("E",10*R,3,3));
+
+  // Largest first: A after the anonymous part, B reuses A's memory,
+  // C goes after B, D after A
+  auto offset = [&](const std::string& name) {
+    return bm.get_allocation(name).get_memory() - bm.get_memory();
+  };
+  REQUIRE (offset("A")==U);
+  REQUIRE (offset("B")==U);
+  REQUIRE (offset("C")==6*U);
+  REQUIRE (offset("D")==11*U);
+
+  REQUIRE (bm.get_allocation("C").allocated_bytes()==3*U*R);
+  REQUIRE (bm.get_allocation("D").allocated_bytes()==(2*U-1)*R);
+  REQUIRE (bm.allocated_bytes()==(13*U-1)*R);
+  // Peak is at slot 0: anonymous + A + D
+  REQUIRE (bm.peak_live_bytes()==(1+10*U+2*U-1)*R);
+  REQUIRE (bm.max_request_bytes()==10*U*R);
+  REQUIRE_THROWS (bm.get_allocation("E"));
+
+  // If no two named requests are live at the same time, they all alias,
+  // and the buffer is as large as the largest one
+  ATMBufferManager seq;
+  seq.request_bytes("A",10*U*R,0,0);
+  seq.request_bytes("B", 5*U*R,1,1);
+  seq.request_bytes("C", 3*U*R,2,2);
+  seq.allocate();
+  REQUIRE (seq.allocated_bytes()==10*U*R);
+  REQUIRE (seq.peak_live_bytes()==10*U*R);
+  REQUIRE (seq.max_request_bytes()==10*U*R);
+}
+
+TEST_CASE("concurrent_buffers", "") {
+  using namespace scream;
+
+  constexpr auto R = sizeof(Real);
+  // Number of bytes in one alignment unit
+  constexpr int UR = ATMBufferManager::alignment;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Register the procs in the factory
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("ScratchUser",&create_atmosphere_process<ScratchUser>);
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  // A and the nested group update different fields, so they are in the same
+  // level of the schedule. B and C run one after the other, while A runs.
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Sequential");
+  params.set<std::string>("atm_procs_list","(A,Nested)");
+  params.set<bool>("concurrent_dispatch",true);
+
+  auto& pa = params.sublist("A");
+  pa.set<std::string>("Type", "ScratchUser");
+  pa.set<std::string>("Grid Name", "Point Grid");
+  pa.set<std::string>("Field Name", "Field A");
+  pa.set<int>("Buffer Bytes", 10*UR);
+
+  auto& pn = params.sublist("Nested");
+  pn.set<std::string>("Type", "Group");
+  pn.set<std::string>("schedule_type","Sequential");
+  pn.set<std::string>("atm_procs_list","(B,C)");
+  int bytes = 4*UR;
+  for (const std::string& name : {"B","C"}) {
+    auto& p = pn.sublist(name);
+    p.set<std::string>("Type", "ScratchUser");
+    p.set<std::string>("Grid Name", "Point Grid");
+    p.set<std::string>("Field Name", "Field B");
+    p.set<int>("Buffer Bytes", bytes);
+    bytes += 2*UR;
+  }
+
+  auto apg = std::make_shared<AtmosphereProcessGroup>(comm,params);
+  apg->set_grids(gm);
+
+  std::map<std::string,Field> fields;
+  for (auto r : apg->get_required_field_requests()) {
+    fields.emplace(r.fid.name(),Field(r.fid));
+  }
+  for (auto& it : fields) {
+    it.second.allocate_view();
+  }
+  for (auto r : apg->get_required_field_requests()) {
+    apg->set_required_field(fields.at(r.fid.name()).get_const());
+  }
+  for (auto r : apg->get_computed_field_requests()) {
+    apg->set_computed_field(fields.at(r.fid.name()));
+  }
+
+  // The level lasts as long as the nested group, that is, two slots
+  ATMBufferManager bm;
+  REQUIRE (apg->num_buffer_slots()==2);
+  REQUIRE (apg->request_buffers(bm)==2);
+  bm.allocate();
+  REQUIRE_NOTHROW (apg->init_buffers(bm));
+
+  // A may run at the same time as either B or C, so its memory cannot overlap theirs
+  auto range = [&](const std::string& name) -> std::pair<long,long> {
+    auto a = bm.get_allocation(name);
+    const long beg = a.get_memory() - bm.get_memory();
+    return {beg, beg + static_cast<long>(a.allocated_bytes()/R)};
+  };
+  auto overlap = [](const std::pair<long,long>& lhs, const std::pair<long,long>& rhs) {
+    return lhs.first<rhs.second && rhs.first<lhs.second;
+  };
+  const auto a = range("Atmosphere Processes::A");
+  const auto b = range("Nested::B");
+  const auto c = range("Nested::C");
+  REQUIRE (not overlap(a,b));
+  REQUIRE (not overlap(a,c));
+}
+
 TEST_CASE("field_checks", "") {
   using namespace scream;
   using namespace ekat::units;
@@ -613,6 +894,132 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("parallel_schedule") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  // Register the AddOne proc in the factory
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("AddOne",&create_atmosphere_process<AddOne>);
+
+  // A group with two AddOne procs, running in parallel
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Parallel");
+  params.set<std::string>("atm_procs_list","(AddOne1,AddOne2)");
+  for (const std::string& name : {"AddOne1","AddOne2"}) {
+    auto& p = params.sublist(name);
+    p.set<std::string>("Type", "AddOne");
+    p.set<std::string>("Grid Name", "Point Grid");
+  }
+
+  auto apg = std::make_shared<AtmosphereProcessGroup>(comm,params);
+  apg->set_grids(gm);
+
+  // Create fields (should be just one) and set it in the group
+  for(const auto& req : apg->get_required_field_requests()) {
+    Field f(req.fid);
+    f.allocate_view();
+    f.deep_copy(0);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    apg->set_required_field(f.get_const());
+    apg->set_computed_field(f);
+  }
+
+  apg->initialize(t0,RunType::Initial);
+
+  // Each proc adds one to the group input. Summing the increments, the
+  // field should increase by 2 at every step
+  for (int n=1; n<=3; ++n) {
+    apg->run(1);
+
+    auto v = apg->get_fields_in().front().get_view<const Real*,Host>();
+    for (size_t i=0; i<v.size(); ++i) {
+      REQUIRE (v[i]==2*n);
+    }
+  }
+}
+
+TEST_CASE ("parallel_schedule_groups") {
+  using namespace scream;
+  using namespace ekat::units;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Register the TracersAddOne proc in the factory
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("TracersAddOne",&create_atmosphere_process<TracersAddOne>);
+
+  // One proc updates the whole tracers group, the other one tracer only
+  ekat::ParameterList params ("Atmosphere Processes");
+  params.set<std::string>("schedule_type","Parallel");
+  params.set<std::string>("atm_procs_list","(AddOneAll,AddOneQa)");
+  for (const std::string& name : {"AddOneAll","AddOneQa"}) {
+    auto& p = params.sublist(name);
+    p.set<std::string>("Type", "TracersAddOne");
+    p.set<std::string>("Grid Name", "Point Grid");
+    p.set<bool>("Use Group", name=="AddOneAll");
+  }
+
+  auto apg = std::make_shared<AtmosphereProcessGroup>(comm,params);
+  REQUIRE_NOTHROW (apg->set_grids(gm));
+
+  // Create the tracers, bundled
+  const auto lt = grid->get_2d_scalar_layout ();
+  FieldManager fm(grid);
+  fm.registration_begins();
+  for (const std::string& name : {"qa","qb"}) {
+    fm.register_field(FieldRequest(FieldIdentifier(name,lt,kg/kg,grid->name()),"tracers"));
+  }
+  fm.register_group(GroupRequest("tracers",grid->name(),Bundling::Required));
+  fm.registration_ends();
+  fm.get_field_group("tracers").m_bundle->deep_copy(0);
+  fm.init_fields_time_stamp(t0);
+
+  // Set computed fields/groups first, like the AD does
+  for (const auto& req : apg->get_computed_field_requests()) {
+    apg->set_computed_field(fm.get_field(req.fid));
+  }
+  for (const auto& req : apg->get_computed_group_requests()) {
+    apg->set_computed_group(fm.get_field_group(req.name));
+  }
+  for (const auto& req : apg->get_required_group_requests()) {
+    apg->set_required_group(fm.get_field_group(req.name).get_const());
+  }
+  for (const auto& req : apg->get_required_field_requests()) {
+    apg->set_required_field(fm.get_field(req.fid).get_const());
+  }
+
+  apg->initialize(t0,RunType::Initial);
+
+  // Both procs increment qa, only one increments qb
+  for (int n=1; n<=3; ++n) {
+    apg->run(1);
+
+    auto qa = fm.get_field("qa").get_view<const Real*,Host>();
+    auto qb = fm.get_field("qb").get_view<const Real*,Host>();
+    for (size_t i=0; i<qa.size(); ++i) {
+      REQUIRE (qa[i]==2*n);
+      REQUIRE (qb[i]==n);
+    }
+  }
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
@@ -4,6 +4,8 @@
 #include "share/grid/point_grid.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include <algorithm>
+
 namespace scream {
 
 template<typename ViewT>
@@ -66,6 +68,13 @@ public:
     return cmvc(m_send_pid_lids_start);
   }
 
+  view_1d<int>::HostMirror get_ov_row_order () const {
+    return cmvc(m_ov_row_order);
+  }
+  int get_num_remote_rows () const {
+    return m_num_remote_rows;
+  }
+
   int gid2lid (const gid_t gid, const grid_ptr_type& grid) const {
     return CoarseningRemapper::gid2lid(gid,grid);
   }
@@ -539,6 +548,23 @@ TEST_CASE ("coarsening_remap") {
       REQUIRE (recv_lids_pidpos(2*i+1,0)==pid2);
     }
   }
+
+  // Check that rows owned by remote pids are computed first
+  const auto ov_row_order = remap->get_ov_row_order();
+  const int num_remote_rows = remap->get_num_remote_rows();
+  const auto ov_owners = tgt_grid->get_owners(ov_gids);
+  REQUIRE (ov_row_order.extent_int(0)==num_loc_ov_tgt_gids);
+  std::vector<int> rows_found(num_loc_ov_tgt_gids,0);
+  for (int i=0; i<num_loc_ov_tgt_gids; ++i) {
+    const int row = ov_row_order(i);
+    ++rows_found[row];
+    if (i<num_remote_rows) {
+      REQUIRE (ov_owners[row]!=comm.rank());
+    } else {
+      REQUIRE (ov_owners[row]==comm.rank());
+    }
+  }
+  REQUIRE (std::count(rows_found.begin(),rows_found.end(),1)==num_loc_ov_tgt_gids);
   print (" -> Checking remapper internal state ... OK!\n",comm);
 
   // -------------------------------------- //
@@ -338,8 +338,53 @@ void run(std::mt19937_64& engine, const ekat::Comm& comm, const gid_type src_min
       }
     }
   } 
-  
-  
+
+  // Test remapping a batch of fields at once against a reference host implementation,
+  // which walks the map segments (rather than the CSR form used by apply_remap).
+  // Use more fields than fit in a single kernel launch, with different inner sizes.
+  const int num_batch_fields = 11;
+  const int num_src_dofs = unique_dofs_from_file.size();
+  std::vector<view_2d<const Real>> x_batch;
+  std::vector<view_2d<Real>>       y_batch;
+  std::vector<view_2d<Real>::HostMirror> x_batch_h;
+  for (int ifield=0; ifield<num_batch_fields; ++ifield) {
+    const int inner = 1 + ifield%4;
+    view_2d<Real> x("",num_src_dofs,inner);
+    auto x_h = Kokkos::create_mirror_view(x);
+    for (int ii=0; ii<num_src_dofs; ++ii) {
+      for (int kk=0; kk<inner; ++kk) {
+        x_h(ii,kk) = x_data_from_file_h(ii)*(kk+1) + ifield;
+      }
+    }
+    Kokkos::deep_copy(x,x_h);
+    x_batch.push_back(x);
+    x_batch_h.push_back(x_h);
+    y_batch.push_back(view_2d<Real>("",num_loc_tgt_cols,inner));
+  }
+  remap_from_file.apply_remap(x_batch,y_batch);
+
+  const auto segments = remap_from_file.get_map_segments();
+  for (int ifield=0; ifield<num_batch_fields; ++ifield) {
+    const auto& x_h = x_batch_h[ifield];
+    const int inner = x_h.extent(1);
+    view_2d<Real>::HostMirror y_ref("",num_loc_tgt_cols,inner);
+    for (const auto& seg : segments) {
+      const auto source_idx_h = seg.get_source_idx_on_host();
+      const auto weights_h    = seg.get_weights_on_host();
+      for (int ii=0; ii<seg.get_length(); ++ii) {
+        for (int kk=0; kk<inner; ++kk) {
+          y_ref(seg.get_dof_idx(),kk) += x_h(source_idx_h(ii),kk)*weights_h(ii);
+        }
+      }
+    }
+    auto y_h = Kokkos::create_mirror_view(y_batch[ifield]);
+    Kokkos::deep_copy(y_h,y_batch[ifield]);
+    for (int ii=0; ii<num_loc_tgt_cols; ++ii) {
+      for (int kk=0; kk<inner; ++kk) {
+        REQUIRE(std::abs(y_h(ii,kk)-y_ref(ii,kk))<tol*100);
+      }
+    }
+  }
 } // end function run
 
 //===============================================================================
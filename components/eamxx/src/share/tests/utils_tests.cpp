@@ -5,6 +5,19 @@
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_timing.hpp"
+#include "share/util/scream_thread_pool.hpp"
+#include "share/util/scream_bit_rounding.hpp"
+
+#include <gptl.h>
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
 
 TEST_CASE("contiguous_superset") {
   using namespace scream;
@@ -237,3 +250,254 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("bit_rounding") {
+  using namespace scream;
+
+  // Exact results
+  REQUIRE (bit_round(1.75f,1)==2.0f);   // Tie: round to even
+  REQUIRE (bit_round(1.25f,1)==1.0f);   // Tie: round to even
+  REQUIRE (bit_round(1.3,1)==1.5);
+  REQUIRE (bit_round(-3.0,1)==-3.0);    // Representable with 1 bit
+  REQUIRE (bit_round(0.0f,4)==0.0f);
+
+  // Nothing to do if we keep all bits
+  REQUIRE (bit_round(0.1,52)==0.1);
+  REQUIRE (bit_round(0.1f,23)==0.1f);
+
+  // Non-finite values are preserved
+  const double inf = std::numeric_limits<double>::infinity();
+  REQUIRE (bit_round(inf,3)==inf);
+  REQUIRE (std::isnan(bit_round(std::nan(""),3)));
+
+  // The relative error is at most 2^-(keep_bits+1), and trailing bits are zero
+  for (int keep_bits : {3, 7, 10, 16}) {
+    const double tol = std::ldexp(1.0,-(keep_bits+1));
+    for (double x : {0.1, -2.718281828, 3.14159e7, 6.02e-23}) {
+      const double y = bit_round(x,keep_bits);
+      REQUIRE (std::abs(y-x)<=tol*std::abs(x));
+      // y*2^keep_bits/2^exponent must be an integer
+      int exp;
+      const double m = std::frexp(y,&exp);
+      const double scaled = std::ldexp(m,keep_bits+1);
+      REQUIRE (scaled==std::round(scaled));
+    }
+  }
+}
+
+TEST_CASE ("timing_scopes") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Scopes are disabled by default
+  REQUIRE (not timing_scopes_enabled());
+  start_timing_scope("disabled");
+  stop_timing_scope("not_started");
+
+  set_timing_scopes_enabled(true);
+  reset_timing_scopes();
+  for (int i=0; i<2; ++i) {
+    TimingScope outer("outer");
+    {
+      TimingScope inner("inner",100);
+    }
+    start_timing_scope("inner2");
+    // Scopes must be stopped in reverse order
+    REQUIRE_THROWS (stop_timing_scope("outer"));
+    stop_timing_scope("inner2",50);
+  }
+
+  auto read_file = [](const std::string& fname) {
+    std::ifstream ifile(fname);
+    std::stringstream ss;
+    ss << ifile.rdbuf();
+    return ss.str();
+  };
+
+  const auto rank_file = "timing_scopes." + std::to_string(comm.rank()) + ".json";
+  write_timing_scopes_to_json(rank_file);
+  const auto rank_json = read_file(rank_file);
+  REQUIRE (rank_json.find("\"path\": \"outer\", \"name\": \"outer\", \"depth\": 0, \"count\": 2")!=std::string::npos);
+  REQUIRE (rank_json.find("\"path\": \"outer/inner\", \"name\": \"inner\", \"depth\": 1, \"count\": 2")!=std::string::npos);
+  REQUIRE (rank_json.find("\"bytes\": 200")!=std::string::npos);
+  REQUIRE (rank_json.find("\"bytes\": 100")!=std::string::npos);
+
+  write_timing_summary_to_json(comm,"timing_scopes_summary.json");
+  if (comm.am_i_root()) {
+    const auto summary = read_file("timing_scopes_summary.json");
+    REQUIRE (summary.find("\"num_ranks\": " + std::to_string(comm.size()))!=std::string::npos);
+    REQUIRE (summary.find("\"path\": \"outer/inner2\"")!=std::string::npos);
+  }
+
+  // The destructor reports scopes stopped out of order, rather than throwing
+  auto stop_out_of_order = [] () {
+    TimingScope outer("outer");
+    start_timing_scope("inner");
+  };
+  REQUIRE_NOTHROW (stop_out_of_order());
+  stop_timing_scope("inner");
+  stop_timing_scope("outer");
+
+  set_timing_scopes_enabled(false);
+}
+
+TEST_CASE ("timer_handles") {
+  using namespace scream;
+
+  bool was_already_inited;
+  init_gptl(was_already_inited);
+
+  auto get_count = [](const std::string& name) {
+    int count = 0, onflg;
+    double wallclock, dusr, dsys;
+    long long papicounters;
+    GPTLquery(name.c_str(),0,&count,&onflg,&wallclock,&dusr,&dsys,&papicounters,0);
+    return count;
+  };
+
+  TimerHandle<0> coarse("timer_handles::coarse");
+  TimerHandle<1> fine("timer_handles::fine");
+  REQUIRE (get_timer_level()==0);
+  for (int i=0; i<3; ++i) {
+    coarse.start();
+    fine.start();
+    fine.stop();
+    coarse.stop();
+  }
+  set_timer_level(1);
+  fine.start();
+  fine.stop();
+  set_timer_level(0);
+  REQUIRE_THROWS (set_timer_level(-1));
+
+  // Timers do nothing off the thread that created them
+  std::thread other([&]() {
+    coarse.start();
+    coarse.stop();
+  });
+  other.join();
+
+  REQUIRE (get_count("timer_handles::coarse")==3);
+  REQUIRE (get_count("timer_handles::fine")==(TimerHandle<1>::compiled_in ? 1 : 0));
+
+  if (not was_already_inited) {
+    finalize_gptl();
+  }
+}
+
+TEST_CASE ("thread_pool") {
+  using namespace scream;
+
+  ThreadPool pool(2);
+  REQUIRE (pool.num_workers()==2);
+
+  // The same threads are reused across runs, and the first task runs on the caller
+  std::vector<std::thread::id> ids(3);
+  std::vector<ThreadPool::task_type> tasks;
+  for (int k=0; k<3; ++k) {
+    tasks.push_back([&,k]() { ids[k] = std::this_thread::get_id(); });
+  }
+  pool.run(tasks);
+  const auto first_ids = ids;
+  REQUIRE (ids[0]==std::this_thread::get_id());
+  REQUIRE (ids[1]!=ids[0]);
+  REQUIRE (ids[2]!=ids[0]);
+  REQUIRE (ids[1]!=ids[2]);
+  pool.run(tasks);
+  REQUIRE (ids==first_ids);
+
+  // Fewer tasks than workers is fine, more is not
+  tasks.pop_back();
+  REQUIRE_NOTHROW (pool.run(tasks));
+  tasks.resize(4,[](){});
+  REQUIRE_THROWS (pool.run(tasks));
+
+  // Exceptions are rethrown once all tasks are done
+  int num_done = 0;
+  std::mutex mutex;
+  auto done = [&]() { std::lock_guard<std::mutex> lock(mutex); ++num_done; };
+  tasks = {done, [&]() { done(); throw std::runtime_error("fail"); }, done};
+  REQUIRE_THROWS (pool.run(tasks));
+  REQUIRE (num_done==3);
+}
+
+TEST_CASE ("step_timing_series") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  bool was_already_inited;
+  init_gptl(was_already_inited);
+
+  // Keep only the last 3 of 5 steps. The second timer is never started.
+  StepTimingSeries series({"step_timing::a","step_timing::missing"},3);
+  for (int step=0; step<5; ++step) {
+    series.start_step();
+    start_timer("step_timing::a");
+    stop_timer("step_timing::a");
+    series.record_step(step);
+  }
+  REQUIRE (series.num_steps()==3);
+  REQUIRE (series.last_step_time()>=0);
+
+  // With a huge tolerance, no rank can be a straggler
+  REQUIRE (series.num_unchecked_steps()==5);
+  const auto stragglers = series.find_stragglers(comm,1e6);
+  REQUIRE (stragglers.empty());
+  REQUIRE (series.num_unchecked_steps()==0);
+
+  // Inject the step times of the ranks: only those exceeding the median
+  // by more than the tolerance are flagged
+  using vod_t = std::vector<double>;
+  using voi_t = std::vector<int>;
+  REQUIRE (StepTimingSeries::find_stragglers(vod_t{1.0,1.1,0.9,3.0},0.5)==voi_t{3});
+  REQUIRE (StepTimingSeries::find_stragglers(vod_t{1.0,1.4,1.0},0.5)==voi_t{});
+  REQUIRE (StepTimingSeries::find_stragglers(vod_t{2.0,1.0,1.0,1.6,1.0},0.5)==voi_t{0,3});
+  REQUIRE (StepTimingSeries::find_stragglers(vod_t{1.0,2.0},0.5)==voi_t{1});
+  REQUIRE (StepTimingSeries::find_stragglers(vod_t{1.0},0)==voi_t{});
+
+  const std::string fname = "step_timing." + std::to_string(comm.rank()) + ".csv";
+  series.write_csv(fname);
+
+  std::ifstream ifile(fname);
+  std::string line;
+  std::getline(ifile,line);
+  REQUIRE (line=="step,step_time,\"step_timing::a\",\"step_timing::missing\"");
+  for (int step=2; step<5; ++step) {
+    REQUIRE (std::getline(ifile,line));
+    std::stringstream ss(line);
+    std::string entry;
+    std::vector<std::string> entries;
+    while (std::getline(ss,entry,',')) {
+      entries.push_back(entry);
+    }
+    REQUIRE (entries.size()==4);
+    REQUIRE (std::stoi(entries[0])==step);
+    REQUIRE (std::stod(entries[2])>=0);
+    REQUIRE (std::stod(entries[3])==0);
+  }
+  REQUIRE (not std::getline(ifile,line));
+
+  // Delay the last rank over two steps: it is the only one flagged, since
+  // the time of both steps is accumulated before checking (only with 2+ ranks)
+  if (comm.size()>1) {
+    const int slow_rank = comm.size()-1;
+    for (int step=5; step<7; ++step) {
+      series.start_step();
+      std::this_thread::sleep_for(std::chrono::milliseconds(comm.rank()==slow_rank ? 100 : 10));
+      series.record_step(step);
+    }
+    REQUIRE (series.num_unchecked_steps()==2);
+    const auto flagged = series.find_stragglers(comm,1.0);
+    if (comm.am_i_root()) {
+      REQUIRE (flagged==voi_t{slow_rank});
+    } else {
+      REQUIRE (flagged.empty());
+    }
+  }
+
+  if (not was_already_inited) {
+    finalize_gptl();
+  }
+}
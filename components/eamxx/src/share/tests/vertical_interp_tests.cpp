@@ -110,6 +110,31 @@ void run(){
         }//end of looping over levels
       }//end of looping over columns
 
+      //Run again reusing precomputed interpolation coefficients,
+      //and make sure we get the same thing back
+      auto out_cached = view_Nd<Pack<Real,P>,2>("",2,npacks_tgt);
+      auto out_cached_h = Kokkos::create_mirror_view(out_cached);
+      auto out_cached_h_s = ekat::scalarize(out_cached_h);
+      ekat::LinInterp<Real,P> cached_interp(2,n_layers_src[i],n_layers_tgt[i]);
+      setup_vertical_interpolation<Real,P>(p_src,
+                                           p_tgt,
+                                           n_layers_src[i],
+                                           n_layers_tgt[i],
+                                           cached_interp);
+      perform_vertical_interpolation<Real,P,2>(p_src,
+                                     p_tgt,
+                                     tmp_src,
+                                     out_cached,
+                                     cached_interp,
+                                     n_layers_src[i],
+                                     n_layers_tgt[i]);
+      Kokkos::deep_copy(out_cached_h,out_cached);
+      for(int col=0; col<2; col++){
+        for(int lev=0; lev<n_layers_tgt[i]; lev++){
+          REQUIRE(out_cached_h_s(col,lev) == out_h_s(col,lev));
+        }
+      }
+
       auto out_1d_test = view_Nd<Pack<Real,P>,2>("",2,npacks_tgt);
       auto out_1d_test_h = Kokkos::create_mirror_view(out_1d_test);
       auto out_1d_test_h_s = ekat::scalarize(out_1d_test_h);
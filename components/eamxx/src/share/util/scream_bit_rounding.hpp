@@ -0,0 +1,77 @@
+#ifndef SCREAM_BIT_ROUNDING_HPP
+#define SCREAM_BIT_ROUNDING_HPP
+
+// For KOKKOS_INLINE_FUNCTION
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace scream {
+
+/*
+ * Utilities to reduce the precision of floating point numbers, to improve
+ * the compression ratio of (lossless) compression algorithms, such as
+ * the deflate filter of NetCDF4.
+ *
+ * We use the "bit rounding" approach (Klöwer et al., 2021): the mantissa
+ * is rounded to the nearest number with only 'keep_bits' significant bits
+ * (ties to even), so that all the trailing bits are zero. Compared to
+ * truncation, this does not introduce a bias, and the max relative error
+ * is 2^-(keep_bits+1).
+ */
+
+template<typename RealT>
+struct FloatBits;
+
+template<>
+struct FloatBits<float> {
+  using uint_type = std::uint32_t;
+  static constexpr int mantissa_bits = 23;
+  static constexpr uint_type exponent_mask = 0x7F800000u;
+};
+
+template<>
+struct FloatBits<double> {
+  using uint_type = std::uint64_t;
+  static constexpr int mantissa_bits = 52;
+  static constexpr uint_type exponent_mask = 0x7FF0000000000000ull;
+};
+
+// Round x so that only the first keep_bits bits of the mantissa may be nonzero.
+// Non-finite values are returned as they are.
+template<typename RealT>
+KOKKOS_INLINE_FUNCTION
+RealT bit_round (const RealT x, const int keep_bits)
+{
+  using traits = FloatBits<RealT>;
+  using uint_t = typename traits::uint_type;
+
+  if (keep_bits>=traits::mantissa_bits) {
+    return x;
+  }
+
+  uint_t bits;
+  memcpy(&bits,&x,sizeof(RealT));
+  if ((bits & traits::exponent_mask)==traits::exponent_mask) {
+    // Inf or NaN
+    return x;
+  }
+
+  // Add half of the last kept bit (minus 1 if the last kept bit is 0, to get ties to even),
+  // then zero out the discarded bits. A carry into the exponent is the correct result.
+  const int shift = traits::mantissa_bits - keep_bits;
+  const uint_t one = 1;
+  const uint_t half = (one << (shift-1)) - one;
+  bits += half + ((bits >> shift) & one);
+  bits &= ~((one << shift) - one);
+
+  RealT y;
+  memcpy(&y,&bits,sizeof(RealT));
+  return y;
+}
+
+} // namespace scream
+
+#endif // SCREAM_BIT_ROUNDING_HPP
@@ -0,0 +1,99 @@
+#include "share/util/scream_thread_pool.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <string>
+
+namespace scream {
+
+ThreadPool::ThreadPool (const int num_workers)
+{
+  EKAT_REQUIRE_MSG (num_workers>=0,
+      "Error! Invalid number of workers for ThreadPool: " + std::to_string(num_workers) + "\n");
+
+  for (int k=1; k<=num_workers; ++k) {
+    m_workers.emplace_back([this,k]() { work(k); });
+  }
+}
+
+ThreadPool::~ThreadPool ()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_start_cv.notify_all();
+  for (auto& w : m_workers) {
+    w.join();
+  }
+}
+
+void ThreadPool::run (const std::vector<task_type>& tasks)
+{
+  EKAT_REQUIRE_MSG (static_cast<int>(tasks.size())<=num_workers()+1,
+      "Error! Too many tasks for ThreadPool.\n"
+      "  - num tasks  : " + std::to_string(tasks.size()) + "\n"
+      "  - num workers: " + std::to_string(num_workers()) + "\n");
+  if (tasks.empty()) {
+    return;
+  }
+
+  // Workers with no task simply report back as done
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks = &tasks;
+    m_errors.assign(tasks.size(),nullptr);
+    m_num_busy = num_workers();
+    ++m_num_runs;
+  }
+  m_start_cv.notify_all();
+
+  try {
+    tasks[0]();
+  } catch (...) {
+    m_errors[0] = std::current_exception();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock,[&]() { return m_num_busy==0; });
+    m_tasks = nullptr;
+  }
+
+  for (const auto& e : m_errors) {
+    if (e) {
+      std::rethrow_exception(e);
+    }
+  }
+}
+
+void ThreadPool::work (const int k)
+{
+  long long num_runs = 0;
+  while (true) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_start_cv.wait(lock,[&]() { return m_stop || m_num_runs!=num_runs; });
+    if (m_stop) {
+      return;
+    }
+    num_runs = m_num_runs;
+    const auto& tasks = *m_tasks;
+    lock.unlock();
+
+    // Each worker only writes its own entry of m_errors
+    if (k<static_cast<int>(tasks.size())) {
+      try {
+        tasks[k]();
+      } catch (...) {
+        m_errors[k] = std::current_exception();
+      }
+    }
+
+    lock.lock();
+    if (--m_num_busy==0) {
+      m_done_cv.notify_one();
+    }
+  }
+}
+
+} // namespace scream
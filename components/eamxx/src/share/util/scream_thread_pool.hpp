@@ -0,0 +1,54 @@
+#ifndef SCREAM_THREAD_POOL_HPP
+#define SCREAM_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace scream {
+
+// A fixed set of host threads, created once and reused, for running a few
+// tasks at the same time over and over (e.g., once per time step), without
+// paying for creating/joining threads on each run.
+// The threads are joined when the pool is destroyed.
+class ThreadPool {
+public:
+  using task_type = std::function<void()>;
+
+  ThreadPool (const int num_workers);
+  ~ThreadPool ();
+
+  ThreadPool (const ThreadPool&) = delete;
+  ThreadPool& operator= (const ThreadPool&) = delete;
+
+  int num_workers () const { return m_workers.size(); }
+
+  // Run tasks[0] on the calling thread, and tasks[k] on the k-th worker,
+  // and return once all tasks are done. There can be at most num_workers()+1
+  // tasks. If any task throws, the exception of the first such task is
+  // rethrown (after all tasks are done).
+  void run (const std::vector<task_type>& tasks);
+
+private:
+  void work (const int k);
+
+  std::vector<std::thread>      m_workers;
+
+  std::mutex                    m_mutex;
+  std::condition_variable       m_start_cv;
+  std::condition_variable       m_done_cv;
+
+  // The tasks of the current run, which is identified by m_num_runs
+  const std::vector<task_type>* m_tasks = nullptr;
+  std::vector<std::exception_ptr> m_errors;
+  long long                     m_num_runs = 0;
+  int                           m_num_busy = 0;
+  bool                          m_stop = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_THREAD_POOL_HPP
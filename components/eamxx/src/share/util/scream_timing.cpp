@@ -1,19 +1,100 @@
 #include "share/util/scream_timing.hpp"
 
+#include "ekat/ekat_assert.hpp"
+
 #include <gptl.h>
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
 
 namespace scream {
 
+namespace {
+
+using timer_clock = std::chrono::steady_clock;
+
+struct ScopeData {
+  std::string name;
+  int         depth = 0;
+  long long   count = 0;
+  double      time  = 0;  // In seconds
+  long long   bytes = 0;
+};
+
+struct ActiveScope {
+  std::string         name;
+  std::string         path;
+  timer_clock::time_point start;
+};
+
+// Scopes data is shared by all threads, while the stack of active scopes is per-thread
+bool                              g_scopes_enabled = false;
+std::mutex                        g_scopes_mutex;
+std::map<std::string,ScopeData>   g_scopes;
+thread_local std::vector<ActiveScope> t_active_scopes;
+
+double gb_per_sec (const long long bytes, const double time) {
+  return time>0 ? bytes/time*1e-9 : 0;
+}
+
+// Incremented whenever GPTL is (re)initialized or finalized, which
+// invalidates all GPTL handles
+int g_gptl_epoch = 0;
+
+} // anonymous namespace
+
+namespace impl {
+
+int g_timer_level = 0;
+
+GptlTimer::GptlTimer (const std::string& name)
+ : m_name (name)
+ , m_owner (std::this_thread::get_id())
+{
+  // Nothing to do here
+}
+
+void GptlTimer::start () {
+  if (std::this_thread::get_id()!=m_owner) {
+    return;
+  }
+  if (m_gptl_epoch!=g_gptl_epoch) {
+    m_handle = nullptr;
+    m_gptl_epoch = g_gptl_epoch;
+  }
+  GPTLstart_handle(m_name.c_str(),&m_handle);
+}
+
+void GptlTimer::stop () {
+  if (std::this_thread::get_id()!=m_owner) {
+    return;
+  }
+  GPTLstop_handle(m_name.c_str(),&m_handle);
+}
+
+} // namespace impl
+
 void init_gptl (bool& was_already_inited) {
 #ifdef SCREAM_CIME_BUILD
   was_already_inited = true;
 #else
   auto ierr = GPTLinitialize();
   was_already_inited = (ierr!=0);
+  if (not was_already_inited) {
+    ++g_gptl_epoch;
+  }
 #endif
 }
 void finalize_gptl () {
   GPTLfinalize();
+  ++g_gptl_epoch;
 }
 
 void start_timer (const std::string& name) {
@@ -28,4 +109,313 @@ void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
 
+void set_timer_level (const int level) {
+  EKAT_REQUIRE_MSG (level>=0, "Error! Invalid timer level: " + std::to_string(level) + "\n");
+  impl::g_timer_level = level;
+}
+
+int get_timer_level () {
+  return impl::g_timer_level;
+}
+
+void set_timing_scopes_enabled (const bool enabled) {
+  g_scopes_enabled = enabled;
+}
+
+bool timing_scopes_enabled () {
+  return g_scopes_enabled;
+}
+
+void start_timing_scope (const std::string& name) {
+  if (not g_scopes_enabled) {
+    return;
+  }
+
+  // Do not charge this scope for kernels launched before it
+  Kokkos::fence();
+
+  ActiveScope scope;
+  scope.name = name;
+  scope.path = t_active_scopes.empty() ? name : t_active_scopes.back().path + "/" + name;
+  scope.start = timer_clock::now();
+  t_active_scopes.push_back(scope);
+}
+
+void stop_timing_scope (const std::string& name, const long long bytes) {
+  if (not g_scopes_enabled) {
+    return;
+  }
+
+  // Wait for the kernels launched inside this scope
+  Kokkos::fence();
+
+  const auto stop = timer_clock::now();
+  EKAT_REQUIRE_MSG (not t_active_scopes.empty() and t_active_scopes.back().name==name,
+      "Error! Timing scopes must be stopped in reverse order of start.\n"
+      "  - scope to stop: " + name + "\n"
+      "  - innermost active scope: " + (t_active_scopes.empty() ? "none" : t_active_scopes.back().name) + "\n");
+
+  const auto& scope = t_active_scopes.back();
+  const std::chrono::duration<double> elapsed = stop - scope.start;
+
+  {
+    std::lock_guard<std::mutex> lock(g_scopes_mutex);
+    auto& data = g_scopes[scope.path];
+    data.name  = name;
+    data.depth = t_active_scopes.size()-1;
+    data.count += 1;
+    data.time  += elapsed.count();
+    data.bytes += bytes;
+  }
+  t_active_scopes.pop_back();
+}
+
+namespace impl {
+
+void stop_timing_scope_nothrow (const std::string& name, const long long bytes) noexcept {
+  try {
+    stop_timing_scope(name,bytes);
+  } catch (std::exception& e) {
+    std::cerr << "WARNING! Could not stop timing scope '" << name << "'.\n"
+              << e.what() << "\n";
+  }
+}
+
+} // namespace impl
+
+void reset_timing_scopes () {
+  std::lock_guard<std::mutex> lock(g_scopes_mutex);
+  g_scopes.clear();
+}
+
+void write_timing_scopes_to_json (const std::string& fname) {
+  std::lock_guard<std::mutex> lock(g_scopes_mutex);
+
+  std::ofstream ofile(fname);
+  EKAT_REQUIRE_MSG (ofile.good(), "Error! Could not open timing file '" + fname + "'.\n");
+
+  ofile << "{\n  \"scopes\": [";
+  bool first = true;
+  for (const auto& it : g_scopes) {
+    const auto& d = it.second;
+    ofile << (first ? "\n" : ",\n")
+          << "    {\"path\": \"" << it.first << "\""
+          << ", \"name\": \"" << d.name << "\""
+          << ", \"depth\": " << d.depth
+          << ", \"count\": " << d.count
+          << ", \"time\": " << d.time
+          << ", \"bytes\": " << d.bytes
+          << ", \"GB/s\": " << gb_per_sec(d.bytes,d.time) << "}";
+    first = false;
+  }
+  ofile << "\n  ]\n}\n";
+}
+
+void write_timing_summary_to_json (const ekat::Comm& comm, const std::string& fname) {
+  // Ranks may not have the same scopes, so use the list of the root rank
+  std::vector<std::string> paths;
+  std::string all_paths;
+  if (comm.am_i_root()) {
+    std::lock_guard<std::mutex> lock(g_scopes_mutex);
+    for (const auto& it : g_scopes) {
+      all_paths += it.first + "\n";
+    }
+  }
+  int len = all_paths.size();
+  comm.broadcast(&len,1,comm.root_rank());
+  all_paths.resize(len);
+  MPI_Bcast(&all_paths[0],len,MPI_CHAR,comm.root_rank(),comm.mpi_comm());
+  size_t pos = 0;
+  while (pos<all_paths.size()) {
+    const auto next = all_paths.find('\n',pos);
+    paths.push_back(all_paths.substr(pos,next-pos));
+    pos = next+1;
+  }
+
+  // Gather local data, in the order of the root rank
+  const int n = paths.size();
+  std::vector<double> times(n,0), gbs(n,0);
+  std::vector<ScopeData> local(n);
+  {
+    std::lock_guard<std::mutex> lock(g_scopes_mutex);
+    for (int i=0; i<n; ++i) {
+      auto it = g_scopes.find(paths[i]);
+      if (it!=g_scopes.end()) {
+        local[i] = it->second;
+        times[i] = it->second.time;
+        gbs[i]   = gb_per_sec(it->second.bytes,it->second.time);
+      }
+    }
+  }
+
+  std::vector<double> min_times(n), max_times(n), sum_times(n), min_gbs(n), max_gbs(n);
+  if (n>0) {
+    comm.all_reduce(times.data(),min_times.data(),n,MPI_MIN);
+    comm.all_reduce(times.data(),max_times.data(),n,MPI_MAX);
+    comm.all_reduce(times.data(),sum_times.data(),n,MPI_SUM);
+    comm.all_reduce(gbs.data(),min_gbs.data(),n,MPI_MIN);
+    comm.all_reduce(gbs.data(),max_gbs.data(),n,MPI_MAX);
+  }
+
+  if (not comm.am_i_root()) {
+    return;
+  }
+
+  std::ofstream ofile(fname);
+  EKAT_REQUIRE_MSG (ofile.good(), "Error! Could not open timing file '" + fname + "'.\n");
+
+  ofile << "{\n  \"num_ranks\": " << comm.size() << ",\n  \"scopes\": [";
+  for (int i=0; i<n; ++i) {
+    const auto& d = local[i];
+    const double avg = sum_times[i] / comm.size();
+    // Load imbalance: fraction of the slowest rank time that is not spent on average
+    const double imbalance = max_times[i]>0 ? (max_times[i]-avg)/max_times[i] : 0;
+    ofile << (i==0 ? "\n" : ",\n")
+          << "    {\"path\": \"" << paths[i] << "\""
+          << ", \"name\": \"" << d.name << "\""
+          << ", \"depth\": " << d.depth
+          << ", \"count\": " << d.count
+          << ", \"time_min\": " << min_times[i]
+          << ", \"time_max\": " << max_times[i]
+          << ", \"time_avg\": " << avg
+          << ", \"imbalance\": " << imbalance
+          << ", \"GB/s_min\": " << min_gbs[i]
+          << ", \"GB/s_max\": " << max_gbs[i] << "}";
+  }
+  ofile << "\n  ]\n}\n";
+}
+
+StepTimingSeries::
+StepTimingSeries (const std::vector<std::string>& timers, const int capacity)
+ : m_timers (timers)
+ , m_timer_exists (timers.size(),false)
+ , m_start_totals (timers.size(),0)
+ , m_capacity (capacity)
+ , m_steps (capacity,0)
+ , m_times (capacity*(1+timers.size()),0)
+{
+  EKAT_REQUIRE_MSG (capacity>0,
+      "Error! Invalid capacity for StepTimingSeries: " + std::to_string(capacity) + "\n");
+
+  m_step_start = timer_clock::now();
+}
+
+void StepTimingSeries::start_step () {
+  // Store the current totals, so that the step only gets its own time
+  update_existing_timers();
+  for (size_t i=0; i<m_timers.size(); ++i) {
+    m_start_totals[i] = 0;
+    if (m_timer_exists[i]) {
+      GPTLget_wallclock(m_timers[i].c_str(),-1,&m_start_totals[i]);
+    }
+  }
+  m_step_start = timer_clock::now();
+}
+
+void StepTimingSeries::record_step (const int step) {
+  const std::chrono::duration<double> elapsed = timer_clock::now() - m_step_start;
+
+  const int ntimers = m_timers.size();
+  const int slot = m_num_recorded % m_capacity;
+  double* times = &m_times[slot*(1+ntimers)];
+
+  m_steps[slot] = step;
+  times[0] = elapsed.count();
+
+  m_unchecked_time += times[0];
+  ++m_num_unchecked;
+
+  update_existing_timers();
+  for (int i=0; i<ntimers; ++i) {
+    double total = 0;
+    if (m_timer_exists[i]) {
+      GPTLget_wallclock(m_timers[i].c_str(),-1,&total);
+    }
+    times[1+i] = total - m_start_totals[i];
+  }
+
+  ++m_num_recorded;
+}
+
+double StepTimingSeries::last_step_time () const {
+  EKAT_REQUIRE_MSG (m_num_recorded>0, "Error! No step was recorded yet.\n");
+  const int slot = (m_num_recorded-1) % m_capacity;
+  return m_times[slot*(1+m_timers.size())];
+}
+
+std::vector<int> StepTimingSeries::
+find_stragglers (const ekat::Comm& comm, const double tol) {
+  double my_time = m_unchecked_time;
+  std::vector<double> times(comm.am_i_root() ? comm.size() : 0);
+  MPI_Gather(&my_time,1,MPI_DOUBLE,times.data(),1,MPI_DOUBLE,comm.root_rank(),comm.mpi_comm());
+  m_unchecked_time = 0;
+  m_num_unchecked = 0;
+
+  if (not comm.am_i_root()) {
+    return {};
+  }
+  return find_stragglers(times,tol);
+}
+
+std::vector<int> StepTimingSeries::
+find_stragglers (const std::vector<double>& times, const double tol) {
+  std::vector<int> stragglers;
+  if (times.empty()) {
+    return stragglers;
+  }
+
+  auto sorted = times;
+  const int imid = (sorted.size()-1)/2;
+  std::nth_element(sorted.begin(),sorted.begin()+imid,sorted.end());
+  const double median = sorted[imid];
+  for (int rank=0; rank<static_cast<int>(times.size()); ++rank) {
+    if (times[rank]>(1+tol)*median) {
+      stragglers.push_back(rank);
+    }
+  }
+  return stragglers;
+}
+
+void StepTimingSeries::write_csv (const std::string& fname) const {
+  std::ofstream ofile(fname);
+  EKAT_REQUIRE_MSG (ofile.good(), "Error! Could not open timing file '" + fname + "'.\n");
+
+  const int ntimers = m_timers.size();
+  ofile << "step,step_time";
+  for (const auto& t : m_timers) {
+    ofile << ",\"" << t << "\"";
+  }
+  ofile << "\n";
+
+  const int n = num_steps();
+  for (int i=m_num_recorded-n; i<m_num_recorded; ++i) {
+    const int slot = i % m_capacity;
+    ofile << m_steps[slot];
+    for (int j=0; j<1+ntimers; ++j) {
+      ofile << "," << m_times[slot*(1+ntimers)+j];
+    }
+    ofile << "\n";
+  }
+}
+
+void StepTimingSeries::update_existing_timers () {
+  int nregions;
+  if (GPTLget_nregions(-1,&nregions)!=0 || nregions==m_num_gptl_regions) {
+    return;
+  }
+  m_num_gptl_regions = nregions;
+
+  std::set<std::string> regions;
+  char name[256];
+  for (int r=0; r<nregions; ++r) {
+    if (GPTLget_regionname(-1,r,name,sizeof(name)-1)==0) {
+      name[sizeof(name)-1] = '\0';
+      regions.insert(name);
+    }
+  }
+  for (size_t i=0; i<m_timers.size(); ++i) {
+    m_timer_exists[i] = regions.count(m_timers[i])>0;
+  }
+}
+
 } // namespace scream
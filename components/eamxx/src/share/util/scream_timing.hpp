@@ -1,9 +1,15 @@
 #ifndef SCREAM_TIMING_HPP
 #define SCREAM_TIMING_HPP
 
+#include "scream_config.h"
+
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace scream {
 
@@ -17,6 +23,181 @@ void stop_timer (const std::string& name);
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
+// Timer levels: 0 is for coarse timers, which are always on, while higher
+// levels are for finer grained timers (e.g., inside physics loops). Timers of
+// level higher than SCREAM_TIMING_MAX_LEVEL are compiled out, while timers
+// of level higher than the run-time level (0 by default) are skipped.
+// The run-time level should not be changed while timers are running.
+void set_timer_level (const int level);
+int get_timer_level ();
+
+namespace impl {
+
+extern int g_timer_level;
+
+// A GPTL timer, whose GPTL handle is resolved on the first start, so that
+// later start/stop calls do not need to look up the timer name. GPTL handles
+// are per-thread, so the timer only runs on the thread that created it, and
+// start/stop do nothing on other threads (e.g., atm procs run concurrently).
+class GptlTimer {
+public:
+  GptlTimer (const std::string& name);
+
+  void start ();
+  void stop ();
+
+  const std::string& name () const { return m_name; }
+private:
+  std::string     m_name;
+  std::thread::id m_owner;
+  void*           m_handle = nullptr;
+  int             m_gptl_epoch = -1;
+};
+
+} // namespace impl
+
+// A timer that can be used in place of start/stop_timer for frequently timed
+// regions. Create it once (e.g., as a static variable), and use it many times:
+//
+//   static TimerHandle<2> timer("EAMxx::P3::ice_sed");
+//   timer.start();
+//   ...
+//   timer.stop();
+template<int Level = 0>
+class TimerHandle {
+public:
+  static constexpr bool compiled_in = Level<=SCREAM_TIMING_MAX_LEVEL;
+
+  TimerHandle (const std::string& name) : m_timer(name) {}
+
+  void start () {
+    if (compiled_in && Level<=impl::g_timer_level) {
+      m_timer.start();
+    }
+  }
+  void stop () {
+    if (compiled_in && Level<=impl::g_timer_level) {
+      m_timer.stop();
+    }
+  }
+
+  const std::string& name () const { return m_timer.name(); }
+private:
+  impl::GptlTimer m_timer;
+};
+
+// Structured timing, independent of GPTL.
+// A scope started while another one is active on the same thread is nested
+// in it, and is identified by its full path, with levels separated by '/'
+// (e.g., "EAMxx::run/EAMxx::physics::run/EAMxx::shoc::run"). When stopping
+// a scope, one can specify the number of bytes moved while the scope was active,
+// which is used to compute the achieved bandwidth.
+// Kernels run asynchronously on device, so starting and stopping a scope
+// fences the device, so that the scope time includes all and only the kernels
+// launched inside it. Since fences are not free, timing scopes are disabled
+// by default, in which case starting/stopping a scope does nothing. Like the
+// timer level, this should not be changed while scopes are active.
+void set_timing_scopes_enabled (const bool enabled);
+bool timing_scopes_enabled ();
+void start_timing_scope (const std::string& name);
+void stop_timing_scope (const std::string& name, const long long bytes = 0);
+void reset_timing_scopes ();
+
+namespace impl {
+// Same as stop_timing_scope, but errors are printed rather than thrown
+void stop_timing_scope_nothrow (const std::string& name, const long long bytes) noexcept;
+} // namespace impl
+
+// RAII wrapper of start/stop_timing_scope
+class TimingScope {
+public:
+  TimingScope (const std::string& name, const long long bytes = 0)
+   : m_name (name), m_bytes (bytes)
+  {
+    start_timing_scope(m_name);
+  }
+  // Destructors must not throw
+  ~TimingScope () { impl::stop_timing_scope_nothrow(m_name,m_bytes); }
+
+  TimingScope (const TimingScope&) = delete;
+  TimingScope& operator= (const TimingScope&) = delete;
+
+  void set_bytes (const long long bytes) { m_bytes = bytes; }
+private:
+  std::string m_name;
+  long long   m_bytes;
+};
+
+// Write the timing scopes of this rank to a JSON file
+void write_timing_scopes_to_json (const std::string& fname);
+
+// Write min/max/avg time, imbalance, and bandwidth of each timing scope across
+// the ranks of the comm to a JSON file (on root rank only). Must be called
+// by all ranks in the comm.
+void write_timing_summary_to_json (const ekat::Comm& comm, const std::string& fname);
+
+// Per-step timing time series.
+// Each step is delimited by start_step/record_step. For each step, the wall
+// time of the step, as well as the time spent during the step in each of a
+// list of GPTL timers, are stored in a ring buffer holding the most recent
+// steps. GPTL only accumulates totals, so the time of a timer during a step
+// is the change in its total between start_step and record_step (hence, timers
+// that are still running at record_step do not count their current interval).
+// Timers that do not exist (yet) get a time of 0.
+class StepTimingSeries {
+public:
+  StepTimingSeries (const std::vector<std::string>& timers, const int capacity);
+
+  void start_step ();
+  void record_step (const int step);
+
+  // Number of steps currently stored
+  int num_steps () const { return std::min(m_num_recorded,m_capacity); }
+
+  // Wall time (in seconds) of the last recorded step
+  double last_step_time () const;
+
+  // Number of steps recorded since the last call to find_stragglers
+  int num_unchecked_steps () const { return m_num_unchecked; }
+
+  // Gather on the root rank of the comm the wall time accumulated over the
+  // steps recorded since the previous call, and return the ranks whose time
+  // exceeds the median over all ranks by more than a fraction tol. The time
+  // is accumulated locally, so this can be called only every few steps, to
+  // limit the communication. Must be called by all ranks in the comm.
+  // The returned list is empty on non-root ranks.
+  std::vector<int> find_stragglers (const ekat::Comm& comm, const double tol);
+
+  // Same as above, given the step times of all ranks. For an even number of
+  // ranks, the lower of the two middle times is used as the median.
+  static std::vector<int> find_stragglers (const std::vector<double>& times, const double tol);
+
+  // Write the stored steps to a CSV file, oldest first. Each row contains
+  // the step, the wall time of the step, and the time of each timer.
+  void write_csv (const std::string& fname) const;
+
+private:
+  // Check which timers exist in GPTL. Only done when new GPTL regions appear.
+  void update_existing_timers ();
+
+  std::vector<std::string>  m_timers;
+  std::vector<bool>         m_timer_exists;
+  std::vector<double>       m_start_totals;
+  int                       m_num_gptl_regions = -1;
+
+  // Ring buffers: step numbers and times, with 1+m_timers.size() entries per step
+  int                       m_capacity;
+  int                       m_num_recorded = 0;
+  std::vector<int>          m_steps;
+  std::vector<double>       m_times;
+
+  // Wall time of the steps recorded since the last call to find_stragglers
+  double                    m_unchecked_time = 0;
+  int                       m_num_unchecked = 0;
+
+  std::chrono::steady_clock::time_point m_step_start;
+};
+
 } // namespace scream
 
 #endif // SCREAM_TIMING_HPP
@@ -121,7 +121,8 @@ void apply_interpolation_impl_1d(
   const int icol,
   const T msk_val,
   const MemberType& team,
-  const LIV<T,P>& vert_interp);
+  const LIV<T,P>& vert_interp,
+  const bool do_setup = true);
 
 /* ---------------------------------------------------------------------- 
  * Versions where x_tgt is a 2-D view
@@ -181,7 +182,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_2d<const Pack<T,P>>& input,
   const view_2d<      Pack<T,P>>& output,
-  const view_2d<        Mask<P>>& mask);
+  const view_2d<        Mask<P>>& mask,
+  const bool do_setup = true);
 
 template<typename T, int P> 
 void apply_interpolation(
@@ -193,7 +195,34 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_3d<const Pack<T,P>>& input,
   const view_3d<      Pack<T,P>>& output,
-  const view_3d<        Mask<P>>& mask);
+  const view_3d<        Mask<P>>& mask,
+  const bool do_setup = true);
+
+/* ----------------------------------------------------------------------
+ * Versions that reuse the interpolation coefficients (bracketing indices
+ * and weights) computed by setup_vertical_interpolation. These only
+ * depend on x_src and x_tgt, so fields sharing the same vertical profiles
+ * can skip the setup (binary searches) done for each field by the
+ * versions above. vert_interp must be built with one dof per column.
+ * ---------------------------------------------------------------------- */
+template<typename T, int P>
+void setup_vertical_interpolation(
+  const view_2d<const Pack<T,P>>& x_src,
+  const view_1d<const Pack<T,P>>& x_tgt,
+  const int nlevs_src,
+  const int nlevs_tgt,
+  const LIV<T,P>& vert_interp);
+
+template<typename T, int P, int N>
+void perform_vertical_interpolation(
+  const view_2d<const Pack<T,P>>&   x_src,
+  const view_1d<const Pack<T,P>>&   x_tgt,
+  const view_Nd<const Pack<T,P>,N>& input,
+  const view_Nd<      Pack<T,P>,N>& output,
+  const LIV<T,P>&                   vert_interp,
+  const int nlevs_src,
+  const int nlevs_tgt,
+  const Real msk_val = masked_val);
 
 // Helper function to allocate memory for an Nd mask on the fly.
 template<int P, int N>
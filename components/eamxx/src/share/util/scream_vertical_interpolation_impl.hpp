@@ -31,7 +31,8 @@ void apply_interpolation_impl_1d(
   const int icol,
   const T msk_val,
   const MemberType& team,
-  const LIV<T,P>& vert_interp)
+  const LIV<T,P>& vert_interp,
+  const bool do_setup)
 {
   // Recast source views to support different packsizes
   using PackInfo = ekat::PackInfo<P>;
@@ -49,8 +50,10 @@ void apply_interpolation_impl_1d(
   EKAT_KERNEL_REQUIRE_MSG(x_tgt.size() == output.size(), "Error! vertical_interpolation::apply_interpolation_imple_1d - target pressure level size does not match the size of the target data output.");
   EKAT_KERNEL_REQUIRE_MSG(x_src.size() == input.size() , "Error! vertical_interpolation::apply_interpolation_imple_1d - source pressure level size does not match the size of the source data input.");
 
-  //Setup linear interpolation
-  vert_interp.setup(team, x_src, x_tgt);
+  //Setup linear interpolation, unless the coefficients were already computed
+  if (do_setup) {
+    vert_interp.setup(team, x_src, x_tgt);
+  }
   //Run linear interpolation
   vert_interp.lin_interp(team, x_src, x_tgt, input, output, icol);
   const auto x_src_s = ekat::scalarize(x_src);
@@ -299,7 +302,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_2d<const Pack<T,P>>& input,
   const view_2d<      Pack<T,P>>& output,
-  const view_2d<        Mask<P>>& mask_out)
+  const view_2d<        Mask<P>>& mask_out,
+  const bool do_setup)
 {
   const int d_0      = input.extent_int(0);
   const int npacks   = output.extent_int(output.rank-1);
@@ -313,7 +317,7 @@ void apply_interpolation(
     const auto out  = ekat::subview(output, icol);
     const auto mask = ekat::subview(mask_out, icol);
     
-    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,icol,mask_val,team,vert_interp);
+    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,icol,mask_val,team,vert_interp,do_setup);
   });
   Kokkos::fence();
 }
@@ -328,7 +332,8 @@ void apply_interpolation(
   const view_1d<const Pack<T,P>>& x_tgt,
   const view_3d<const Pack<T,P>>& input,
   const view_3d<      Pack<T,P>>& output,
-  const view_3d<        Mask<P>>& mask_out)
+  const view_3d<        Mask<P>>& mask_out,
+  const bool do_setup)
 {
   const int d_0      = input.extent_int(0);
   const int num_vars = input.extent_int(1);
@@ -344,10 +349,66 @@ void apply_interpolation(
     const auto out  = ekat::subview(output, icol, ivar);
     const auto mask = ekat::subview(mask_out, icol, ivar);
 
-    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,team.league_rank(),mask_val,team,vert_interp);
+    // If the coefficients were computed beforehand, they are stored once per column
+    const int idof  = do_setup ? team.league_rank() : icol;
+
+    apply_interpolation_impl_1d<T,P>(x1,x_tgt,in,out,mask,num_levs_src,num_levs_tgt,idof,mask_val,team,vert_interp,do_setup);
   });
   Kokkos::fence();   
 }
+
+/* ----------------------------------------------------------------------
+ * Versions reusing precomputed interpolation coefficients
+ * ---------------------------------------------------------------------- */
+template<typename T, int P>
+void setup_vertical_interpolation(
+  const view_2d<const Pack<T,P>>& x_src,
+  const view_1d<const Pack<T,P>>& x_tgt,
+  const int nlevs_src,
+  const int nlevs_tgt,
+  const LIV<T,P>& vert_interp)
+{
+  using PackInfo = ekat::PackInfo<P>;
+  const int num_src_packs = PackInfo::num_packs(nlevs_src);
+  const int num_tgt_packs = PackInfo::num_packs(nlevs_tgt);
+
+  EKAT_REQUIRE(num_src_packs <= x_src.extent_int(1));
+  EKAT_REQUIRE(num_tgt_packs <= x_tgt.extent_int(0));
+
+  const int ncols   = x_src.extent_int(0);
+  const auto policy = ESU::get_default_team_policy(ncols, num_tgt_packs);
+  Kokkos::parallel_for("scream_vert_interp_setup", policy,
+               KOKKOS_LAMBDA(MemberType const& team) {
+    const int  icol = team.league_rank();
+    const auto x1   = Kokkos::subview(ekat::subview(x_src, icol),Kokkos::pair<int,int>(0,num_src_packs));
+    const auto xt   = Kokkos::subview(x_tgt,Kokkos::pair<int,int>(0,num_tgt_packs));
+
+    vert_interp.setup(team, x1, xt);
+  });
+  Kokkos::fence();
+}
+
+template<typename T, int P, int N> 
+void perform_vertical_interpolation(
+  const view_2d<const Pack<T,P>>&   x_src,
+  const view_1d<const Pack<T,P>>&   x_tgt,
+  const view_Nd<const Pack<T,P>,N>& input,
+  const view_Nd<      Pack<T,P>,N>& output,
+  const LIV<T,P>&                   vert_interp,
+  const int nlevs_src,
+  const int nlevs_tgt,
+  const Real msk_val)
+{
+  perform_checks<T,P,N>(x_src, x_tgt, input, output, nlevs_src, nlevs_tgt);
+
+  std::vector<int> extents;
+  for (int ii=0;ii<output.rank;ii++) {
+    extents.push_back(output.extent_int(ii));
+  }
+  const auto mask = allocate_mask<P,N>(extents);
+
+  apply_interpolation(nlevs_src, nlevs_tgt, msk_val, vert_interp, x_src, x_tgt, input, output, mask, false);
+}
   
 } // namespace vinterp
 } // namespace scream
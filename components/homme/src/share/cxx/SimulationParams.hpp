@@ -61,6 +61,8 @@ struct SimulationParams
   double    scale_factor; // radius of Earth in sphere case; propagated then to Geometry and SphereOps
   double    laplacian_rigid_factor; // propagated to SphereOps
   bool      pgrad_correction;
+  bool      dirk_active_set = false; // DIRK Newton iterates only unconverged columns
+  bool      caar_overlap_exchange = false; // CAAR overlaps the boundary exchange with interior elements
 
   double    dp3d_thresh;
   double    vtheta_thresh;
@@ -108,6 +110,8 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   laplacian_rigid_factor: " << laplacian_rigid_factor << "\n";
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
+  out << "   dirk_active_set: " << (dirk_active_set ? "yes" : "no") << "\n";
+  out << "   caar_overlap_exchange: " << (caar_overlap_exchange ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
@@ -51,6 +51,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_interior_pack_pending = false;
 }
 
 BoundaryExchange::BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
@@ -191,6 +192,46 @@ void BoundaryExchange::clean_up()
   m_cleaned_up = true;
 }
 
+// Append the num_fields fields stored in src to the fields stored in dst,
+// starting at column dst_offset.
+template<typename FieldsView>
+static void append_fields (const FieldsView& dst, const int dst_offset,
+                           const FieldsView& src, const int num_fields, const int num_elems)
+{
+  if (num_fields==0) {
+    return;
+  }
+  Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {num_elems, num_fields}, {1, 1}),
+                       KOKKOS_LAMBDA(const int ie, const int ifield){
+    dst(ie, dst_offset+ifield) = src(ie, ifield);
+  });
+}
+
+void BoundaryExchange::register_fields (const BoundaryExchange& src)
+{
+  // Sanity checks
+  assert (m_registration_started && !m_registration_completed);
+  assert (src.m_registration_completed);
+  assert (src.m_connectivity==m_connectivity);
+  assert (m_num_1d_fields==0 && src.m_num_1d_fields==0);
+  assert (m_num_2d_fields+src.m_num_2d_fields<=m_2d_fields.extent_int(1));
+  assert (m_num_3d_fields+src.m_num_3d_fields<=m_3d_fields.extent_int(1));
+  assert (m_num_3d_int_fields+src.m_num_3d_int_fields<=m_3d_int_fields.extent_int(1));
+
+  append_fields(m_2d_fields, m_num_2d_fields, src.m_2d_fields, src.m_num_2d_fields, m_num_elems);
+  append_fields(m_3d_fields, m_num_3d_fields, src.m_3d_fields, src.m_num_3d_fields, m_num_elems);
+  append_fields(m_3d_int_fields, m_num_3d_int_fields, src.m_3d_int_fields, src.m_num_3d_int_fields, m_num_elems);
+
+  // src's host nlev vector is cleared at registration_completed if all its fields have NUM_LEV levels
+  for (int i = 0; i < src.m_num_3d_fields; ++i) {
+    m_3d_nlev_pack.push_back(src.m_3d_nlev_pack.empty() ? NUM_LEV : src.m_3d_nlev_pack[i]);
+  }
+
+  m_num_2d_fields += src.m_num_2d_fields;
+  m_num_3d_fields += src.m_num_3d_fields;
+  m_num_3d_int_fields += src.m_num_3d_int_fields;
+}
+
 void BoundaryExchange::registration_completed()
 {
   // If everything is already set up, just return
@@ -324,18 +365,32 @@ void BoundaryExchange::exchange_min_max ()
   recv_and_unpack_min_max ();
 }
 
+// Pack the connections of the elements in the given ranges of the lists sorted by
+// sharing (see Connectivity). Packing all elements is elem/conn_beg=0, elem/conn_end=size.
+struct PackRange {
+  ExecViewUnmanaged<const int*> elems;
+  ExecViewUnmanaged<const int*> conns;
+  int elem_beg, elem_end;
+  int conn_beg, conn_end;
+
+  int num_elems () const { return elem_end-elem_beg; }
+  int num_conns () const { return conn_end-conn_beg; }
+};
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const PackRange& range, const int num_2d_fields) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
-  const int nconn = ucon.extent_int(0);
+  const int nconn = range.num_conns();
+  const auto conns = range.conns;
+  const int conn_beg = range.conn_beg;
   Kokkos::parallel_for(
     Kokkos::RangePolicy<ExecSpace>(0, num_2d_fields*nconn),
     KOKKOS_LAMBDA(const int it) {
-      const int iconn = it / num_2d_fields;
+      const int iconn = conns(conn_beg + it / num_2d_fields);
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
@@ -355,7 +410,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const PackRange& range, const int num_3d_fields,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -363,7 +418,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
   if (partial_column) nlev_packs = *nlev_packs_;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
-    const int nconn = ucon.extent_int(0);
+    const int nconn = range.num_conns();
+    const auto conns = range.conns;
+    const int conn_beg = range.conn_beg;
     Kokkos::parallel_for(
       Kokkos::RangePolicy<ExecSpace>(0, num_3d_fields*nconn*NUM_LEV_PACKS),
       KOKKOS_LAMBDA(const int it) {
@@ -373,7 +430,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
           if (ilev >= nlev_packs(ifield))
             return;
         }
-        const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
+        const int iconn = conns(conn_beg + it / (num_3d_fields*NUM_LEV_PACKS));
         const auto& info = ucon(iconn);
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
@@ -385,7 +442,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
           sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
       });
   } else {
-    const auto num_parallel_iterations = num_elems*num_3d_fields;
+    const auto num_parallel_iterations = range.num_elems()*num_3d_fields;
+    const auto elems = range.elems;
+    const int elem_beg = range.elem_beg;
     ThreadPreferences tp;
     tp.max_threads_usable = NP;
     tp.max_vectors_usable = NUM_LEV_PACKS;
@@ -398,7 +457,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
     Kokkos::parallel_for(policy,
       KOKKOS_LAMBDA(const TeamMember& team) {
         Homme::KernelVariables kv(team, num_3d_fields);
-        const int ie = kv.ie;
+        const int ie = elems(elem_beg + kv.ie);
         const int ifield = kv.iq;
         const auto tvr = Kokkos::ThreadVectorRange(
           kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
@@ -428,6 +487,54 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 void BoundaryExchange::pack_and_send ()
 {
   tstart("be pack_and_send");
+  if (prepare_pack()) {
+    const int nelems = m_connectivity->get_num_local_elements();
+    const int nconn = m_connectivity->get_d_conns_by_sharing().extent_int(0);
+    pack(0, nelems, 0, nconn);
+    send();
+  }
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_and_send_boundary ()
+{
+  tstart("be pack_and_send");
+  if (prepare_pack()) {
+    // Post the receives first, so that neighbors can send while we pack
+    if (!m_recv_pending) {
+      if ( ! m_recv_requests.empty())
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                                m_connectivity->get_comm().mpi_comm());
+      m_recv_pending = true;
+    }
+    pack(0, m_connectivity->get_num_boundary_elements(),
+         0, m_connectivity->get_num_boundary_connections());
+    send();
+    m_interior_pack_pending = true;
+  }
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_interior ()
+{
+  // Interior elements only have local connections, which do not go through
+  // MPI buffers, so we can pack them while the sends are in flight.
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+  assert (m_send_pending && m_interior_pack_pending);
+
+  tstart("be pack_interior");
+  pack(m_connectivity->get_num_boundary_elements(),
+       m_connectivity->get_num_local_elements(),
+       m_connectivity->get_num_boundary_connections(),
+       m_connectivity->get_d_conns_by_sharing().extent_int(0));
+  m_interior_pack_pending = false;
+  tstop("be pack_interior");
+}
+
+bool BoundaryExchange::prepare_pack ()
+{
   // The registration MUST be completed by now
   // Note: this also implies connectivity and buffers manager are valid
   assert (m_registration_completed);
@@ -437,7 +544,7 @@ void BoundaryExchange::pack_and_send ()
 
   // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
   if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
-    return;
+    return false;
   }
 
   // Check that buffers are not locked by someone else, then lock them
@@ -452,29 +559,49 @@ void BoundaryExchange::pack_and_send ()
     build_buffer_views_and_requests();
     tstop("be build_buffer_views_and_requests");
   }
+  return true;
+}
+
+void BoundaryExchange::pack (const int elem_beg, const int elem_end,
+                             const int conn_beg, const int conn_end)
+{
+  if (elem_beg==elem_end) {
+    return;
+  }
+
+  PackRange range;
+  range.elems = m_connectivity->get_d_elems_by_sharing();
+  range.conns = m_connectivity->get_d_conns_by_sharing();
+  range.elem_beg = elem_beg;
+  range.elem_end = elem_end;
+  range.conn_beg = conn_beg;
+  range.conn_end = conn_end;
 
   // ---- Pack ---- //
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
+    Homme::pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, range,
+                m_num_2d_fields);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+      Homme::pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                                 range, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+      Homme::pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                           range, m_num_3d_fields);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
+    Homme::pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                           range, m_num_3d_int_fields);
   Kokkos::fence();
+}
 
+void BoundaryExchange::send ()
+{
   // ---- Send ---- //
   tstart("be sync_send_buffer");
   m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
@@ -486,7 +613,7 @@ void BoundaryExchange::pack_and_send ()
 
   // Notify a send is ongoing
   m_send_pending = true;
-  tstop("be pack_and_send");
+  tstop("be send");
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -657,6 +784,9 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
     return;
   }
 
+  // If the pack was split, the interior elements must have been packed too
+  assert (!m_interior_pack_pending);
+
   // If I am doing pack_and_send and recv_and_unpack manually (rather than
   // through 'exchange'), then I need to start receiving now (otherwise it is
   // done already inside 'exchange')
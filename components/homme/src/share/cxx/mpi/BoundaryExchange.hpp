@@ -181,6 +181,15 @@ public:
                                >::type field,
         int num_dims, int start_dim, int nlev);
 
+  // Register all the fields of another BE, so that they are exchanged together with
+  // the fields of this BE, in one message per neighbor. This allows to aggregate
+  // exchanges that have no dependency on each other, cutting the number of messages.
+  // The src BE must have completed its registration, and cannot be a min/max BE.
+  // The number of fields declared in set_num_fields must account for src's fields.
+  // Note: all fields are exchanged with the same rspheremp option, so only aggregate
+  //       BEs that would be exchanged with the same option.
+  void register_fields (const BoundaryExchange& src);
+
   // This registration method should be used for the exchange of min/max fields
   template<int DIM, typename... Properties>
   void register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
@@ -218,6 +227,16 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) { recv_and_unpack(&rspheremp); }
+
+  // Split version of pack_and_send, to overlap the exchange with computations:
+  //  - pack_and_send_boundary: packs only the elements that have a remote neighbor,
+  //    and starts the sends (and the recvs, if not yet started);
+  //  - pack_interior: packs the remaining elements, which only have local neighbors.
+  // Hence, the fields on interior elements can still be modified between the two calls.
+  // Both must be called before recv_and_unpack.
+  void pack_and_send_boundary ();
+  void pack_interior ();
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -293,6 +312,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_interior_pack_pending;
 
   int         m_num_elems;
 
@@ -300,6 +320,13 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+
+  // Helpers of pack_and_send and its split version. Ranges refer to the
+  // elements/connections sorted by sharing (see Connectivity).
+  bool prepare_pack ();
+  void pack (const int elem_beg, const int elem_end, const int conn_beg, const int conn_end);
+  void send ();
+
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
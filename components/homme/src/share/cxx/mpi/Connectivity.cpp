@@ -9,6 +9,7 @@
 
 #include <array>
 #include <algorithm>
+#include <vector>
 
 namespace Homme
 {
@@ -18,6 +19,8 @@ Connectivity::Connectivity ()
  , m_initialized  (false)
  , m_num_local_elements (-1)
  , m_max_corner_elements(-1)
+ , m_num_boundary_elements   (0)
+ , m_num_boundary_connections(0)
 {
   // Nothing to be done here
 }
@@ -136,6 +139,7 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+  setup_elems_by_sharing();
 
   m_finalized = true;
 }
@@ -313,6 +317,48 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::setup_elems_by_sharing () {
+  const int nconn = h_ucon.extent_int(0);
+
+  d_elems_by_sharing = decltype(d_elems_by_sharing)("Elements by sharing",m_num_local_elements);
+  d_conns_by_sharing = decltype(d_conns_by_sharing)("Connections by sharing",nconn);
+  const auto h_elems = Kokkos::create_mirror_view(d_elems_by_sharing);
+  const auto h_conns = Kokkos::create_mirror_view(d_conns_by_sharing);
+
+  std::vector<int> interior;
+  m_num_boundary_elements = 0;
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool is_boundary = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+      is_boundary = is_boundary || h_ucon(k).sharing == etoi(ConnectionSharing::SHARED);
+    }
+    if (is_boundary) {
+      h_elems(m_num_boundary_elements++) = ie;
+    } else {
+      interior.push_back(ie);
+    }
+  }
+  std::copy(interior.begin(),interior.end(),h_elems.data()+m_num_boundary_elements);
+
+  int iconn = 0;
+  for (int i = 0; i < m_num_local_elements; ++i) {
+    if (i == m_num_boundary_elements) {
+      m_num_boundary_connections = iconn;
+    }
+    const int ie = h_elems(i);
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+      h_conns(iconn++) = k;
+    }
+  }
+  if (m_num_boundary_elements == m_num_local_elements) {
+    m_num_boundary_connections = iconn;
+  }
+  assert (iconn == nconn);
+
+  Kokkos::deep_copy(d_elems_by_sharing, h_elems);
+  Kokkos::deep_copy(d_conns_by_sharing, h_conns);
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
@@ -322,6 +368,10 @@ void Connectivity::clean_up()
   h_ucon = decltype(h_ucon)("", 0);
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
+  d_elems_by_sharing = decltype(d_elems_by_sharing)("", 0);
+  d_conns_by_sharing = decltype(d_conns_by_sharing)("", 0);
+  m_num_boundary_elements = 0;
+  m_num_boundary_connections = 0;
 
   m_initialized = false;
   m_finalized   = false;
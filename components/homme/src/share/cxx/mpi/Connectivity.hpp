@@ -100,6 +100,15 @@ public:
   HostViewUnmanaged<const ConnectionInfo*> get_h_ucon () const { return h_ucon; }
   HostViewUnmanaged<const int*> get_h_ucon_ptr () const { return h_ucon_ptr; }
 
+  // Local elements, sorted so that the boundary elements (i.e., those with at least
+  // one connection shared with another process) come first, followed by the interior
+  // elements. The connections are sorted accordingly: all the connections of the
+  // boundary elements come first. This allows to pack/unpack the two groups separately.
+  ExecViewUnmanaged<const int*> get_d_elems_by_sharing () const { return d_elems_by_sharing; }
+  ExecViewUnmanaged<const int*> get_d_conns_by_sharing () const { return d_conns_by_sharing; }
+  int get_num_boundary_elements    () const { return m_num_boundary_elements; }
+  int get_num_boundary_connections () const { return m_num_boundary_connections; }
+
   // Get number of connections with given kind and sharing
   template<typename MemSpace>
   KOKKOS_INLINE_FUNCTION
@@ -156,6 +165,11 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+
+  ExecViewManaged<int*>             d_elems_by_sharing;
+  ExecViewManaged<int*>             d_conns_by_sharing;
+  int                               m_num_boundary_elements;
+  int                               m_num_boundary_connections;
   // Helper used to accumulated connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,6 +181,8 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // Sort elements and connections in boundary/interior groups. Must be called after setup_ucon.
+  void setup_elems_by_sharing();
 };
 
 } // namespace Homme
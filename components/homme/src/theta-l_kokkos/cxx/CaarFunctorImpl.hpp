@@ -92,6 +92,7 @@ struct CaarFunctorImpl {
   const bool          m_theta_hydrostatic_mode;
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
+  const bool          m_overlap_requested;
 
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
@@ -104,6 +105,7 @@ struct CaarFunctorImpl {
   SphereOperators       m_sphere_ops;
 
   struct TagPreExchange {};
+  struct TagPreExchangeSubset {};
   struct TagPostExchange {};
 
   // Policies
@@ -117,6 +119,20 @@ struct CaarFunctorImpl {
 
   TeamPolicyType<TagPreExchange>   m_policy_pre;
 
+  // If true, run the pre-exchange loop separately on the elements with remote neighbors
+  // and on the interior ones, so that the exchange of the former overlaps with the
+  // computation of the latter. Only done if requested (caar_overlap_exchange in the
+  // namelist), and if this rank has both kinds of elements.
+  // The subset policies have the same team size and vector length as m_policy_pre,
+  // since the workspace slots (see m_tu) depend on the team size.
+  bool m_overlap_exchange = false;
+  TeamPolicyType<TagPreExchangeSubset> m_policy_pre_boundary;
+  TeamPolicyType<TagPreExchangeSubset> m_policy_pre_interior;
+  ExecViewUnmanaged<const int*>        m_elems_by_sharing;
+  int                                  m_num_boundary_elems = 0;
+  // The first entry of m_elems_by_sharing processed by the current TagPreExchangeSubset loop
+  int                                  m_elems_beg = 0;
+
   Kokkos::RangePolicy<ExecSpace, TagPostExchange> m_policy_post;
 
   TeamUtils<ExecSpace> m_tu;
@@ -131,6 +147,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_requested(params.caar_overlap_exchange)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +171,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_overlap_requested(params.caar_overlap_exchange)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -320,6 +338,25 @@ struct CaarFunctorImpl {
       }
       be.registration_completed();
     }
+
+    // Elements with remote neighbors come first, then the interior ones
+    const auto& connectivity = *bm_exchange->get_connectivity();
+    m_elems_by_sharing = connectivity.get_d_elems_by_sharing();
+    m_num_boundary_elems = connectivity.get_num_boundary_elements();
+    const int num_interior_elems = m_num_elems - m_num_boundary_elems;
+    const auto tv = DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+    m_policy_pre_boundary = TeamPolicyType<TagPreExchangeSubset>(m_num_boundary_elems,tv.first,tv.second);
+    m_policy_pre_interior = TeamPolicyType<TagPreExchangeSubset>(num_interior_elems,tv.first,tv.second);
+    m_policy_pre_boundary.set_chunk_size(1);
+    m_policy_pre_interior.set_chunk_size(1);
+    assert (m_policy_pre_boundary.team_size()==m_policy_pre.team_size());
+    m_overlap_exchange = m_overlap_requested && m_num_boundary_elems>0 && num_interior_elems>0;
+  }
+
+  // Can be used to force the split pre-exchange loop (even if one of the
+  // subsets is empty), or to disable it. Call after init_boundary_exchanges.
+  void set_overlap_exchange (const bool overlap) {
+    m_overlap_exchange = overlap;
   }
 
   void set_rk_stage_data (const RKStageData& data) {
@@ -342,18 +379,50 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
     int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_overlap_exchange) {
+      auto& be = *m_bes[data.np1];
+
+      // Compute elements with remote neighbors, and send their data
+      GPTLstart("caar compute");
+      m_elems_beg = 0;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (boundary elems)", m_policy_pre_boundary, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchangeSubset", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      be.pack_and_send_boundary();
+      GPTLstop("caar_bexchV");
+
+      // Compute interior elements while messages are in flight
+      GPTLstart("caar compute");
+      m_elems_beg = m_num_boundary_elems;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (interior elems)", m_policy_pre_interior, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchangeSubset", data.n0);
+
+      GPTLstart("caar_bexchV");
+      be.pack_interior();
+      be.recv_and_unpack(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    } else {
+      GPTLstart("caar compute");
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -369,10 +438,21 @@ struct CaarFunctorImpl {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team, int& nerr) const {
-    // In this body, we use '====' to separate sync epochs (delimited by barriers)
-    // Note: make sure the same temp is not used within each epoch!
+    KernelVariables kv(team, m_tu);
+    compute_pre_exchange(kv,nerr);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPreExchangeSubset&, const TeamMember &team, int& nerr) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems_by_sharing(m_elems_beg + kv.ie);
+    compute_pre_exchange(kv,nerr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange (KernelVariables& kv, int& nerr) const {
+    // In this body, we use '====' to separate sync epochs (delimited by barriers)
+    // Note: make sure the same temp is not used within each epoch!
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
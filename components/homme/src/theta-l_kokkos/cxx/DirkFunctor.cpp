@@ -7,16 +7,22 @@
 #include "DirkFunctor.hpp"
 #include "DirkFunctorImpl.hpp"
 #include "Context.hpp"
+#include "SimulationParams.hpp"
+#include "mpi/Comm.hpp"
 
 #include "profiling.hpp"
 
 #include <assert.h>
+#include <cstdio>
 #include <type_traits>
 
 namespace Homme {
 
 DirkFunctor::DirkFunctor (int nelem) {
-  m_dirk_impl.reset(new DirkFunctorImpl(nelem));
+  const auto& params = Context::singleton().get<SimulationParams>();
+  assert(params.params_set);
+  m_active_set = params.dirk_active_set;
+  m_dirk_impl.reset(new DirkFunctorImpl(nelem, m_active_set));
 }
 
 // Note: you cannot declare the default destructor in the header,
@@ -41,4 +47,27 @@ void DirkFunctor::run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int n
   GPTLstop("compute_stage_value_dirk");
 }
 
+std::vector<int> DirkFunctor::get_newton_iteration_histogram () const {
+  return m_dirk_impl->get_newton_iteration_histogram();
+}
+
+void DirkFunctor::print_newton_iteration_histogram (const Comm& comm) {
+  // The histogram is only recorded with the active set. m_active_set is a
+  // namelist option, so all ranks return here together.
+  if ( ! m_active_set) return;
+  auto hist = m_dirk_impl->get_accumulated_newton_iteration_histogram(true);
+  const int n = hist.size();
+  std::vector<long long> global(n);
+  MPI_Reduce(hist.data(), global.data(), n, MPI_LONG_LONG, MPI_SUM, 0, comm.mpi_comm());
+  if ( ! comm.root()) return;
+
+  long long ncol = 0;
+  for (const auto c : global) ncol += c;
+  if (ncol == 0) return;
+  printf("DIRK Newton iterations (active set), columns per iteration count:\n");
+  for (int i = 0; i < n-1; ++i)
+    if (global[i] > 0) printf("  %2d: %lld\n", i+1, global[i]);
+  printf("  not converged: %lld\n", global[n-1]);
+}
+
 } // Namespace Homme
@@ -9,9 +9,11 @@
 
 #include "Types.hpp"
 #include <memory>
+#include <vector>
 
 namespace Homme {
 
+class Comm;
 class FunctorsBuffersManager;
 class DirkFunctorImpl;
 class Elements;
@@ -32,8 +34,20 @@ public:
   void run(int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
            const Elements& elements, const HybridVCoord& hvcoord);
 
+  // Entry n-1 is the number of columns whose Newton iteration converged in n
+  // iterations in the last call to run; the last entry counts the columns that
+  // did not converge. Only recorded when the active set is enabled.
+  std::vector<int> get_newton_iteration_histogram() const;
+
+  // Sum the Newton iteration histograms of all calls to run since the last
+  // print over the ranks in comm, print the result on the root rank, and reset
+  // the sums. Does nothing unless the active set is enabled. Must be called on
+  // all ranks in comm.
+  void print_newton_iteration_histogram(const Comm& comm);
+
 private:
   std::unique_ptr<DirkFunctorImpl> m_dirk_impl;
+  bool m_active_set;
 };
 
 } // Namespace Homme
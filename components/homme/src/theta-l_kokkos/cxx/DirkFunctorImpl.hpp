@@ -20,6 +20,7 @@
 #include "utilities/scream_tridiag.hpp"
 
 #include <cassert>
+#include <vector>
 
 namespace Homme {
 
@@ -31,6 +32,7 @@ struct DirkFunctorImpl {
   enum : int { num_lev_aligned = max_num_lev_pack*packn };
   enum : int { num_phys_lev = NUM_PHYSICAL_LEV };
   enum : int { num_work = 12 };
+  enum : int { max_newton_iter = 20 };
   enum : bool { calc_initial_guess_in_newton_kernel = false };
 
   enum : int {
@@ -65,6 +67,27 @@ struct DirkFunctorImpl {
     = Kokkos::View<Scalar    [num_phys_lev][npack],
                    Kokkos::LayoutRight, ExecSpace,
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  // Linear system slot holding only the active packs, contiguously, as the
+  // tridiagonal solvers require LayoutRight.
+  using CompactSlot
+    = Kokkos::View<Scalar**,
+                   Kokkos::LayoutRight, ExecSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  // Active set state: row 0 flags the converged columns, row 1 holds their
+  // last Newton increment. Only allocated if the active set is enabled.
+  using ActiveSet
+    = Kokkos::View<Scalar*[2][npack],
+                   Kokkos::LayoutRight, ExecSpace>;
+  using ActiveSetSlot
+    = Kokkos::View<Scalar [2][npack],
+                   Kokkos::LayoutRight, ExecSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  // Entry n-1 is the number of columns that converged in n Newton iterations;
+  // the last entry is the number of columns that did not converge. Only
+  // recorded by runs with the active set.
+  using IterHist = Kokkos::View<int[max_newton_iter+1], ExecSpace>;
+  // Sum of the IterHist of all calls to run since the last reset.
+  using IterHistTotal = Kokkos::View<long long[max_newton_iter+1], ExecSpace>;
 
   KOKKOS_INLINE_FUNCTION
   static WorkSlot get_work_slot (const Work& w, const int& wi, const int& si) {
@@ -85,12 +108,21 @@ struct DirkFunctorImpl {
 
   Work m_work;
   LinearSystem m_ls;
+  ActiveSet m_cnv;
+  IterHist m_iter_hist;
+  IterHistTotal m_iter_hist_total;
   TeamPolicy m_policy, m_ig_policy;
   TeamUtils<ExecSpace> m_tu, m_tu_ig;
   int nslot;
+  bool m_active_set;
 
-  DirkFunctorImpl (const int nelem)
+  // If active_set, a column stops iterating once its own Newton increment is
+  // small enough, and the Jacobian and tridiagonal solve are computed only for
+  // the columns still iterating. This is not BFB with the F90 code, in which
+  // all columns in an element iterate until every one of them has converged.
+  DirkFunctorImpl (const int nelem, const bool active_set = false)
     : m_policy(1,1,1), m_ig_policy(1,1,1), m_tu(m_policy), m_tu_ig(m_ig_policy) // throwaway settings
+    , m_active_set(active_set)
   {
     init(nelem);
   }
@@ -122,11 +154,31 @@ struct DirkFunctorImpl {
     nslot = std::min(nelem, m_tu.get_num_ws_slots());
     m_ig_policy = Homme::get_default_team_policy<ExecSpace>(nelem);
     m_tu_ig = TeamUtils<ExecSpace>(m_ig_policy);
+    m_iter_hist = IterHist("DirkFunctorImpl::m_iter_hist");
+    m_iter_hist_total = IterHistTotal("DirkFunctorImpl::m_iter_hist_total");
+  }
+
+  // Newton iteration histogram of the last call to run with the active set.
+  // See IterHist.
+  std::vector<int> get_newton_iteration_histogram () const {
+    const auto h = Kokkos::create_mirror_view(m_iter_hist);
+    Kokkos::deep_copy(h, m_iter_hist);
+    return std::vector<int>(h.data(), h.data() + h.size());
+  }
+
+  // Sum of the Newton iteration histograms of all calls to run since the last
+  // reset. If reset, zero the sum after reading it.
+  std::vector<long long> get_accumulated_newton_iteration_histogram (const bool reset) {
+    const auto h = Kokkos::create_mirror_view(m_iter_hist_total);
+    Kokkos::deep_copy(h, m_iter_hist_total);
+    if (reset) Kokkos::deep_copy(m_iter_hist_total, 0);
+    return std::vector<long long>(h.data(), h.data() + h.size());
   }
 
   int requested_buffer_size () const {
     // FunctorsBuffersManager wants the size in terms of sizeof(Real).
-    return (Work::shmem_size(nslot) + LinearSystem::shmem_size(nslot))/sizeof(Real);
+    return (Work::shmem_size(nslot) + LinearSystem::shmem_size(nslot) +
+            (m_active_set ? ActiveSet::shmem_size(nslot) : 0))/sizeof(Real);
   }
 
   void init_buffers (const FunctorsBuffersManager& fbm) {
@@ -134,6 +186,10 @@ struct DirkFunctorImpl {
     m_work = Work(mem, nslot);
     mem += Work::shmem_size(nslot)/sizeof(Scalar);
     m_ls = LinearSystem(mem, nslot);
+    if (m_active_set) {
+      mem += LinearSystem::shmem_size(nslot)/sizeof(Scalar);
+      m_cnv = ActiveSet(mem, nslot);
+    }
   }
 
   void run (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
@@ -145,6 +201,13 @@ struct DirkFunctorImpl {
     }
 
     run_newton(nm1, alphadt_nm1, n0, alphadt_n0, np1, dt2, e, hvcoord, bfb_solver);
+
+    if (m_active_set) {
+      const auto hist = m_iter_hist;
+      const auto hist_total = m_iter_hist_total;
+      Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, max_newton_iter+1),
+                           KOKKOS_LAMBDA (const int i) { hist_total(i) += hist(i); });
+    }
     Kokkos::fence();
   }
 
@@ -207,7 +270,7 @@ struct DirkFunctorImpl {
 
     const auto grav = PhysicalConstants::g;
     const int nvec = npack;
-    const int maxiter = 20;
+    const int maxiter = max_newton_iter;
 #ifdef HOMMEXX_BFB_TESTING
     const Real deltatol = 1e-6; // In bfb testing, use coarse tolerance, due to zeroulp calls
 #else
@@ -226,6 +289,11 @@ struct DirkFunctorImpl {
     const auto e_initial_guess = e.m_derived.m_divdp_proj;
     const auto hybi = hvcoord.hybrid_bi;
     const auto tu   = m_tu;
+    const auto active_set = m_active_set;
+    const auto cnv_all = m_cnv;
+    const auto hist = m_iter_hist;
+
+    if (active_set) Kokkos::deep_copy(m_iter_hist, 0);
 
     const auto toplevel = KOKKOS_LAMBDA (const MT& team, int& nerr) {
       KernelVariables kv(team, tu);
@@ -249,7 +317,8 @@ struct DirkFunctorImpl {
       const auto
       dl = get_ls_slot(ls, kv.team_idx, 0),
       d  = get_ls_slot(ls, kv.team_idx, 1),
-      du = get_ls_slot(ls, kv.team_idx, 2);
+      du = get_ls_slot(ls, kv.team_idx, 2),
+      xa = get_ls_slot(ls, kv.team_idx, 3);
 
       // View of xfull for use in the solver. We want xfull so that we
       // can use the nlevp-1 entry, which we make sure is 0, when convenient.
@@ -339,6 +408,18 @@ struct DirkFunctorImpl {
 
       loop_ki(kv, nlev, nvec, [&] (int k, int i) { dphi_n0(k,i) = phi_n0(k+1,i) - phi_n0(k,i); });
 
+      // Active set: the Jacobian and solve are computed for the packs act[0:nact]
+      // only. pos is the inverse map, with -1 for inactive packs. cnv(0,i)[s]
+      // is 1 once column (i,s) has converged; such a column is frozen.
+      int act[npack], pos[npack], nact = nvec;
+      ActiveSetSlot cnv;
+      if (active_set) {
+        cnv = subview(cnv_all, kv.team_idx, a, a);
+        for (int i = 0; i < nvec; ++i) act[i] = pos[i] = i;
+        loop_ki(kv, 1, nvec, [&] (int, int i) { cnv(0,i) = 0; });
+        kv.team_barrier();
+      }
+
       int it = 0;
       Real deltaerr;
       for (; it < maxiter; ++it) { // Newton iteration
@@ -346,13 +427,34 @@ struct DirkFunctorImpl {
                                                dphi, pnh, wrk, dpnh_dp_i);
         if ( ! ok) nerr = 1;
         kv.team_barrier();
-        loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
-          x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
-        });
+        if (active_set) {
+          const CompactSlot
+            dlc(dl.data(), nlev, nact), dc(d.data(), nlev, nact),
+            duc(du.data(), nlev, nact), xc(xa.data(), nlev, nact);
+          loop_ki(kv, nlev, nact, [&] (const int k, const int j) {
+            const int i = act[j];
+            xc(k,j) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
+          });
 
-        calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
-        kv.team_barrier();
-        if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+          calc_jacobian(kv, dt2, dp3d, dphi, pnh, dlc, dc, duc, nlev, act, nact);
+          kv.team_barrier();
+          if (bfb_solver) solvebfb(kv, dlc, dc, duc, xc); else solve(kv, dlc, dc, duc, xc);
+          kv.team_barrier();
+
+          // Frozen columns get a zero increment.
+          loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
+            if (pos[i] < 0) x(k,i) = 0;
+            else x(k,i) = xc(k,pos[i])*(1 - cnv(0,i));
+          });
+        } else {
+          loop_ki(kv, nlev, nvec, [&] (const int k, const int i) {
+            x(k,i) = -(w_np1(k,i) - (w_n0(k,i) + grav*dt2*(dpnh_dp_i(k,i) - 1))); // -residual
+          });
+
+          calc_jacobian(kv, dt2, dp3d, dphi, pnh, dl, d, du);
+          kv.team_barrier();
+          if (bfb_solver) solvebfb(kv, dl, d, du, x); else solve(kv, dl, d, du, x);
+        }
         kv.team_barrier();
 
         loop_ki(kv, 1, nvec, [&] (int k, int i) { wrk(2,i) = 1; });
@@ -377,7 +479,13 @@ struct DirkFunctorImpl {
 
         loop_ki(kv, nlev, nvec, [&] (int k, int i) { w_np1(k,i) += wrk(2,i)*x(k,i); });
 
-        if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) break;
+        if (active_set) {
+          update_active_set(kv, nlev, nvec, wmax, deltatol, x, it+1, hist, cnv,
+                            deltaerr, act, pos, nact);
+          if (nact == 0) break;
+        } else if (exit_on_step(kv, nlev, nvec, wmax, deltatol, x, deltaerr)) {
+          break;
+        }
       } // Newton iteration
       kv.team_barrier();
 
@@ -385,6 +493,15 @@ struct DirkFunctorImpl {
         printf("[DIRK] WARNING! Newton reached max iteration count,"
                " with deltaerr = %3.17f\n", deltaerr);
         nerr = 1;
+        if (active_set) {
+          // Count the columns that did not converge.
+          loop_ki(kv, 1, nvec, [&] (int, int i) {
+            for (int s = 0; s < packn; ++s) {
+              if (scaln % packn != 0 && i*packn + s >= scaln) break;
+              if (cnv(0,i)[s] == 0) Kokkos::atomic_increment(&hist(maxiter));
+            }
+          });
+        }
       }
 
       // Update phi_np1.
@@ -704,33 +821,78 @@ struct DirkFunctorImpl {
     return deltaerr/wmax < deltatol;
   }
 
+  // Per-column version of exit_on_step. Columns whose increment x is below
+  // tolerance are marked as converged in cnv(0,:), their iteration count niter
+  // is recorded in hist, and the active set act[0:nact], with inverse map pos,
+  // is rebuilt from the packs that still have a column iterating. deltaerr is
+  // the max increment over the columns that were active.
+  KOKKOS_INLINE_FUNCTION
+  static void update_active_set (const KernelVariables& kv, const int nlev, const int nvec,
+                                 const Real& wmax, const Real& deltatol,
+                                 const LinearSystemSlot& x, const int niter,
+                                 const IterHist& hist, const ActiveSetSlot& cnv,
+                                 Real& deltaerr, int* act, int* pos, int& nact) {
+    loop_ki(kv, 1, nvec, [&] (int, int i) {
+      for (int s = 0; s < packn; ++s) {
+        if (scaln % packn != 0 && i*packn + s >= scaln) break;
+        Real err = 0;
+        if (cnv(0,i)[s] == 0) {
+          for (int k = 0; k < nlev; ++k)
+            err = max(err, std::abs(x(k,i)[s]));
+          if (err/wmax < deltatol) {
+            cnv(0,i)[s] = 1;
+            Kokkos::atomic_increment(&hist(niter-1));
+          }
+        }
+        cnv(1,i)[s] = err;
+      }
+    });
+    kv.team_barrier();
+    // Each thread builds its own copy of the active set.
+    nact = 0;
+    deltaerr = 0;
+    for (int i = 0; i < nvec; ++i) {
+      bool active = false;
+      for (int s = 0; s < packn; ++s) {
+        if (scaln % packn != 0 && i*packn + s >= scaln) break;
+        deltaerr = max(deltaerr, cnv(1,i)[s]);
+        if (cnv(0,i)[s] == 0) active = true;
+      }
+      pos[i] = active ? nact : -1;
+      if (active) act[nact++] = i;
+    }
+  }
+
   /* Compute Jacobian of F(phi) = sum(dphi) + const + (dt*g)^2 *(1-dp/dpi)
      column wise with respect to phi. Form the tridiagonal analytical Jacobian J
      to solve J * x = -f.
 
      This code will need to change when the equation of state is changed.
   */
+  // If act is provided, only the packs act[0:nact] are computed, and they are
+  // stored contiguously in dl, d, du: column j of these is pack act[j].
   template <typename R, typename W>
   KOKKOS_INLINE_FUNCTION
   static void calc_jacobian (const KernelVariables& kv, const Real& dt2,
                              // All arrays are in DIRK format.
                              const R& dp3d, const R& dphi, const R& pnh,
                              const W& dl, const W& d, const W& du,
-                             const int nlev = NUM_PHYSICAL_LEV) {
+                             const int nlev = NUM_PHYSICAL_LEV,
+                             const int* act = nullptr, const int nact = npack) {
     using Kokkos::parallel_for;
 
-    const int n = npack;
+    const int n = nact;
     const auto pv = Kokkos::ThreadVectorRange(kv.team, n);
     const auto pt1 = Kokkos::TeamThreadRange(kv.team, 1);
 
     const Real a = square(dt2*PhysicalConstants::g)/(1 - PhysicalConstants::kappa);
 
     const auto f1 = [&] (const int) {
-      const auto ks = [&] (const int i) { // first Jacobian row
-        const int k = 0;
+      const auto ks = [&] (const int j) { // first Jacobian row
+        const int k = 0, i = act ? act[j] : j;
         const auto b = a/dp3d(k,i);
-        du(k,i) = 2*b*(pnh(k,i)/dphi(k,i));
-        d (k,i) = 1 - du(k,i);
+        du(k,j) = 2*b*(pnh(k,i)/dphi(k,i));
+        d (k,j) = 1 - du(k,j);
       };
       parallel_for(pv, ks);
     };
@@ -739,27 +901,28 @@ struct DirkFunctorImpl {
       // The following is morally a const var, but there are issues with
       // gnu and std=c++14. The macro ConstExceptGnu is defined in share/cxx/Config.hpp.
       ConstExceptGnu  auto k = km1 + 1;
-      const auto kmid = [&] (const int i) { // middle Jacobian rows
+      const auto kmid = [&] (const int j) { // middle Jacobian rows
+        const int i = act ? act[j] : j;
         const auto b = 2*a/(dp3d(k-1,i) + dp3d(k,i));
-        dl(k,i) = b*(pnh(k-1,i)/dphi(k-1,i));
-        du(k,i) = b*(pnh(k  ,i)/dphi(k  ,i));
+        dl(k,j) = b*(pnh(k-1,i)/dphi(k-1,i));
+        du(k,j) = b*(pnh(k  ,i)/dphi(k  ,i));
         // In all rows k,
         //     dl <= 0, du <= 0,
         // and thus
         //     d = 1 + |dl| + |du| > |dl| + |du|,
         // making this Jacobian matrix strictly diagonally dominant. Thus, we
         // need not pivot when factorizing the matrix.
-        d (k,i) = 1 - dl(k,i) - du(k,i);
+        d (k,j) = 1 - dl(k,j) - du(k,j);
       };
       parallel_for(pv, kmid);
     };
     parallel_for(Kokkos::TeamThreadRange(kv.team, nlev-2), f2);
     const auto f3 = [&] (const int) {
-      const auto ke = [&] (const int i) { // last Jacobian row
-        const int k = nlev-1;
+      const auto ke = [&] (const int j) { // last Jacobian row
+        const int k = nlev-1, i = act ? act[j] : j;
         const auto b = 2*a/(dp3d(k-1,i) + dp3d(k,i));
-        dl(k,i) = b*(pnh(k-1,i)/dphi(k-1,i));
-        d (k,i) = 1 - dl(k,i) - b*(pnh(k,i)/dphi(k,i));        
+        dl(k,j) = b*(pnh(k-1,i)/dphi(k-1,i));
+        d (k,j) = 1 - dl(k,j) - b*(pnh(k,i)/dphi(k,i));        
       };
       parallel_for(pv, ke);
     };
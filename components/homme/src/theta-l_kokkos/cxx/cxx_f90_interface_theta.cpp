@@ -47,7 +47,8 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const bool& dirk_active_set,
+                               const bool& caar_overlap_exchange)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -123,6 +124,8 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.pgrad_correction              = pgrad_correction;
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
+  params.dirk_active_set               = dirk_active_set;
+  params.caar_overlap_exchange         = caar_overlap_exchange;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -629,6 +632,14 @@ void sync_diagnostics_to_host_c ()
   Context::singleton().get<Diagnostics>().sync_diagnostics_to_host();
 }
 
+void print_dirk_newton_histogram_c ()
+{
+  auto& c = Context::singleton();
+  if (c.has<DirkFunctor>()) {
+    c.get<DirkFunctor>().print_newton_iteration_histogram(c.get<Comm>());
+  }
+}
+
 } // extern "C"
 
 } // namespace Homme
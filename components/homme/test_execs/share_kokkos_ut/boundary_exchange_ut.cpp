@@ -50,7 +50,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::uniform_int_distribution<int>   dint(0,1);
 
   constexpr int ne        = 2;
-  constexpr int num_tests = 1;
+  constexpr int num_tests = 3;
   constexpr int DIM       = 2;
   constexpr double test_tolerance = 1e-13;
   constexpr int num_min_max_fields_1d = 1; // Count min and max of a field as 1, does not count the x2 due to min and max
@@ -115,6 +115,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::shared_ptr<BoundaryExchange> be1 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be2 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be3 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager_min_max);
+  std::shared_ptr<BoundaryExchange> be12 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
 
   // Setup the be objects
   be1->set_num_fields(0,num_scalar_fields_2d,DIM*num_vector_fields_3d);
@@ -131,6 +132,14 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
+  // Aggregate the fields of be1 and be2, to exchange them in one message per neighbor
+  be12->set_num_fields(0,be1->get_num_2d_fields()+be2->get_num_2d_fields(),
+                         be1->get_num_3d_fields()+be2->get_num_3d_fields(),
+                         be1->get_num_3d_int_fields()+be2->get_num_3d_int_fields());
+  be12->register_fields(*be1);
+  be12->register_fields(*be2);
+  be12->registration_completed();
+
   for (int itest=0; itest<num_tests; ++itest)
   {
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
@@ -210,10 +219,21 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be3->exchange_min_max();
     } else {
       be3->pack_and_send_min_max();
-      be1->pack_and_send();
-      be1->recv_and_unpack();
-      be2->pack_and_send();
-      be2->recv_and_unpack();
+      if (itest%3==2) {
+        // Fused exchange of be1 and be2 fields
+        be12->exchange();
+      } else {
+        be1->pack_and_send();
+        be1->recv_and_unpack();
+        if (itest%2==0) {
+          be2->pack_and_send();
+        } else {
+          // Split pack, as used to overlap exchange and computation
+          be2->pack_and_send_boundary();
+          be2->pack_interior();
+        }
+        be2->recv_and_unpack();
+      }
       be3->recv_and_unpack_min_max();
     }
     Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
@@ -306,4 +326,5 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be1->clean_up();
   be2->clean_up();
   be3->clean_up();
+  be12->clean_up();
 }
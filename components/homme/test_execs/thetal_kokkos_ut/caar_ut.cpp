@@ -439,6 +439,86 @@ TEST_CASE("caar", "caar_testing") {
     }
   }
 
+  SECTION ("caar_overlap_exchange") {
+    // The split pre-exchange loop (overlapping the exchange with the computation
+    // of interior elements) must give the same answer as the unsplit one.
+    params.theta_hydrostatic_mode = false;
+    params.theta_adv_form = AdvectionForm::NonConservative;
+    params.rsplit = 0;
+
+    Real dt = RPDF(1.0,10.0)(engine);
+    Real eta_ave_w = RPDF(0.1,1.0)(engine);
+    int  np1 = IPDF(0,2)(engine);
+    auto mpi_comm = comm.mpi_comm();
+    MPI_Bcast(&dt,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&eta_ave_w,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&np1,1,MPI_INT,0,mpi_comm);
+    const int n0  = (np1+1)%3;
+    const int nm1 = (np1+2)%3;
+    RKStageData data (nm1, n0, np1, 0, dt, eta_ave_w, 1.0, 1.0, 1.0);
+
+    CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+    FunctorsBuffersManager fbm;
+    fbm.request_size( caar.requested_buffer_size() );
+    fbm.request_size( limiter.requested_buffer_size() );
+    fbm.allocate();
+    caar.init_buffers(fbm);
+    limiter.init_buffers(fbm);
+    caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+
+    // Run with and without overlap, from the same initial state
+    std::vector<decltype(Kokkos::create_mirror_view(elems.m_state.m_dp3d))> dp3d(2);
+    std::vector<decltype(Kokkos::create_mirror_view(elems.m_state.m_vtheta_dp))> vtheta_dp(2);
+    std::vector<decltype(Kokkos::create_mirror_view(elems.m_state.m_w_i))> w_i(2);
+    std::vector<decltype(Kokkos::create_mirror_view(elems.m_state.m_phinh_i))> phinh_i(2);
+    std::vector<decltype(Kokkos::create_mirror_view(elems.m_state.m_v))> v(2);
+    for (int overlap : {0,1}) {
+      elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+      elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+
+      caar.set_overlap_exchange(overlap==1);
+      caar.run(data);
+
+      dp3d[overlap]      = Kokkos::create_mirror_view(elems.m_state.m_dp3d);
+      vtheta_dp[overlap] = Kokkos::create_mirror_view(elems.m_state.m_vtheta_dp);
+      w_i[overlap]       = Kokkos::create_mirror_view(elems.m_state.m_w_i);
+      phinh_i[overlap]   = Kokkos::create_mirror_view(elems.m_state.m_phinh_i);
+      v[overlap]         = Kokkos::create_mirror_view(elems.m_state.m_v);
+      Kokkos::deep_copy(dp3d[overlap],      elems.m_state.m_dp3d);
+      Kokkos::deep_copy(vtheta_dp[overlap], elems.m_state.m_vtheta_dp);
+      Kokkos::deep_copy(w_i[overlap],       elems.m_state.m_w_i);
+      Kokkos::deep_copy(phinh_i[overlap],   elems.m_state.m_phinh_i);
+      Kokkos::deep_copy(v[overlap],         elems.m_state.m_v);
+    }
+
+    for (int ie=0; ie<num_elems; ++ie) {
+      auto dp3d_0      = viewAsReal(Homme::subview(dp3d[0],ie,np1));
+      auto dp3d_1      = viewAsReal(Homme::subview(dp3d[1],ie,np1));
+      auto vtheta_dp_0 = viewAsReal(Homme::subview(vtheta_dp[0],ie,np1));
+      auto vtheta_dp_1 = viewAsReal(Homme::subview(vtheta_dp[1],ie,np1));
+      auto w_i_0       = viewAsReal(Homme::subview(w_i[0],ie,np1));
+      auto w_i_1       = viewAsReal(Homme::subview(w_i[1],ie,np1));
+      auto phinh_i_0   = viewAsReal(Homme::subview(phinh_i[0],ie,np1));
+      auto phinh_i_1   = viewAsReal(Homme::subview(phinh_i[1],ie,np1));
+      auto v_0         = viewAsReal(Homme::subview(v[0],ie,np1));
+      auto v_1         = viewAsReal(Homme::subview(v[1],ie,np1));
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+            REQUIRE(dp3d_0(igp,jgp,k)==dp3d_1(igp,jgp,k));
+            REQUIRE(vtheta_dp_0(igp,jgp,k)==vtheta_dp_1(igp,jgp,k));
+            REQUIRE(v_0(0,igp,jgp,k)==v_1(0,igp,jgp,k));
+            REQUIRE(v_0(1,igp,jgp,k)==v_1(1,igp,jgp,k));
+          }
+          for (int k=0; k<NUM_INTERFACE_LEV; ++k) {
+            REQUIRE(w_i_0(igp,jgp,k)==w_i_1(igp,jgp,k));
+            REQUIRE(phinh_i_0(igp,jgp,k)==phinh_i_1(igp,jgp,k));
+          }
+        }
+      }
+    }
+  }
+
   SECTION ("limiter_dp3d") {
 
     // rsplit and hydro_mode are irrelevant for this test, so just pick something
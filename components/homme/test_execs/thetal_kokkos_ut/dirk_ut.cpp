@@ -692,6 +692,9 @@ TEST_CASE ("dirk_toplevel_testing") {
   DirkFunctorImpl d(nelemd);
   FunctorsBuffersManager fbm;
   init(d, fbm);
+  DirkFunctorImpl d_as(nelemd, true /* active set */);
+  FunctorsBuffersManager fbm_as;
+  init(d_as, fbm_as);
 
   { // Test initial guess function.
     init_elems(ne, nelemd, r, hvcoord, e);
@@ -765,6 +768,8 @@ TEST_CASE ("dirk_toplevel_testing") {
         w_i1("w_i1", nelemd), w_i2("w_i2", nelemd);
       decltype(ElementsState::m_phinh_i) phinh_i("phinh_i", nelemd),
         phinh_i1("phinh_i1", nelemd), phinh_i2("phinh_i2", nelemd);
+      decltype(ElementsState::m_w_i) w_i3("w_i3", nelemd);
+      decltype(ElementsState::m_phinh_i) phinh_i3("phinh_i3", nelemd);
 
       bool good = false;
       for (int trial = 0; trial < 100 /* don't enter an inf loop */; ++trial) {
@@ -827,6 +832,28 @@ TEST_CASE ("dirk_toplevel_testing") {
         deep_copy(e.m_state.m_w_i, w_i);
         deep_copy(e.m_state.m_phinh_i, phinh_i);
 
+        // Run C++ with BFB solver and the Newton active set.
+        d_as.get_accumulated_newton_iteration_histogram(true);
+        d_as.run(nm1, alphadtwt_nm1*dt2, n0, alphadtwt_n0*dt2, np1, dt2,
+                 e, hvcoord, true /* BFB solver */);
+        fence();
+        deep_copy(w_i3, e.m_state.m_w_i);
+        deep_copy(phinh_i3, e.m_state.m_phinh_i);
+        // Restore state.
+        deep_copy(e.m_state.m_w_i, w_i);
+        deep_copy(e.m_state.m_phinh_i, phinh_i);
+
+        // Every column is counted once in the iteration histogram.
+        int ncol = 0;
+        const auto hist = d_as.get_newton_iteration_histogram();
+        for (const int n : hist) ncol += n;
+        REQUIRE(ncol == nelemd*np*np);
+        // The accumulated histogram was reset just before this run.
+        const auto hist_total = d_as.get_accumulated_newton_iteration_histogram(false);
+        REQUIRE(hist_total.size() == hist.size());
+        for (size_t i = 0; i < hist.size(); ++i)
+          REQUIRE(hist_total[i] == hist[i]);
+
         break;
       }
 
@@ -848,6 +875,23 @@ TEST_CASE ("dirk_toplevel_testing") {
                 REQUIRE(almost_equal(p1[k], p2[k], 1e6*eps));
             }
 
+      // Test that running with and without the Newton active set produces
+      // similar answers. Columns are frozen at different iterates, so these
+      // agree to about the Newton tolerance only.
+      {
+        const auto w3m = cmvdc(w_i3);
+        const auto phinh3m = cmvdc(phinh_i3);
+        for (int ie = 0; ie < nelemd; ++ie)
+          for (int i = 0; i < np; ++i)
+            for (int j = 0; j < np; ++j)
+              for (int f = 0; f < 2; ++f) {
+                Real* p2 = f == 0 ? &w2m(ie,np1,i,j,0)[0] : &phinh2m(ie,np1,i,j,0)[0];
+                Real* p3 = f == 0 ? &w3m(ie,np1,i,j,0)[0] : &phinh3m(ie,np1,i,j,0)[0];
+                for (int k = 0; k < nlev+1; ++k)
+                  REQUIRE(almost_equal(p2[k], p3[k], 1e-5));
+              }
+      }
+
       // Run F90 with BFB solver.
       c2f(e);
       compute_stage_value_dirk_f90(nm1+1, alphadtwt_nm1*dt2, n0+1, alphadtwt_n0*dt2, np1+1, dt2);